@@ -60,6 +60,11 @@ void WCDBCoreSetAutoCheckpointMinFrames(int frames)
     WCDB::CommonCore::shared().setCheckPointMinFrames(frames);
 }
 
+void WCDBCoreSetNumberOfOperationWorkers(int numberOfWorkers)
+{
+    WCDB::CommonCore::shared().setNumberOfOperationWorkers(numberOfWorkers);
+}
+
 void WCDBCoreReleaseSQLiteMemory(int bytes)
 {
     WCDB::CommonCore::shared().releaseSQLiteMemory(bytes);
@@ -397,8 +397,8 @@ CPPExpression WCDBExpressionInExpressionOperate(CPPExpression operand,
     newExpression->syntax().inSwitcher = WCDB::Expression::SyntaxType::SwitchIn::Expressions;
     newExpression->syntax().isNot = isNot;
     WCDBGetCPPSyntaxList(WCDB::Expression, cppExpressions, expressions, num);
-    newExpression->syntax().expressions.splice(
-    newExpression->syntax().expressions.end(), cppExpressions);
+    newExpression->syntax().expressions.insert(
+    newExpression->syntax().expressions.end(), cppExpressions.begin(), cppExpressions.end());
     return ret;
 }
 
@@ -71,7 +71,7 @@ FileHandle::FileHandle(FileHandle &&other)
 
 FileHandle::~FileHandle()
 {
-    WCTAssert(!isOpened() || m_mode != Mode::OverWrite);
+    WCTAssert(!isOpened() || (m_mode != Mode::OverWrite && m_mode != Mode::Append));
     close();
 }
 
@@ -94,6 +94,11 @@ bool FileHandle::open(Mode mode)
         GetPathString(path), O_BINARY | O_CREAT | O_WRONLY | O_TRUNC, FileFullAccess);
         break;
     }
+    case Mode::Append: {
+        m_fd = wcdb_open(
+        GetPathString(path), O_BINARY | O_CREAT | O_WRONLY | O_APPEND, FileFullAccess);
+        break;
+    }
     default:
         WCTAssert(mode == Mode::ReadOnly);
         m_fd = wcdb_open(GetPathString(path), O_RDONLY | O_BINARY);
@@ -202,6 +207,71 @@ Data FileHandle::read(size_t size)
     return data.subdata(got + prior);
 }
 
+Data FileHandle::read(offset_t offset, size_t size, SharedHighWater highWater, bool reportError)
+{
+    if (size == 0) {
+        return Data::null();
+    }
+    WCTAssert(isOpened());
+    Data data(nullptr, size, highWater);
+    if (data.empty()) {
+        return Data::null();
+    }
+    size_t prior = 0;
+    unsigned char *buffer = data.buffer();
+    while (prior < size) {
+#ifndef _WIN32
+        ssize_t got = ::pread(m_fd, buffer + prior, size - prior, (off_t) (offset + prior));
+        if (got < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (reportError) {
+                setThreadedError();
+            }
+            return Data::null();
+        }
+#else
+        HANDLE handle = (HANDLE) _get_osfhandle(m_fd);
+        OVERLAPPED overlapped = {};
+        offset_t position = offset + prior;
+        overlapped.Offset = (DWORD) (position & 0xffffffff);
+        overlapped.OffsetHigh = (DWORD) (position >> 32);
+        DWORD got = 0;
+        if (!ReadFile(handle, buffer + prior, (DWORD) (size - prior), &got, &overlapped)
+            && GetLastError() != ERROR_HANDLE_EOF) {
+            if (!reportError) {
+                return Data::null();
+            }
+            Error error;
+            error.level = m_errorIgnorable ? Error::Level::Warning : Error::Level::Error;
+            error.setWinSystemCode(GetLastError(), Error::Code::IOError);
+            error.infos.insert_or_assign(ErrorStringKeyAssociatePath, path);
+            Notifier::shared().notify(error);
+            SharedThreadedErrorProne::setThreadedError(std::move(error));
+            return Data::null();
+        }
+#endif
+        if (got == 0) {
+            break;
+        }
+        prior += got;
+    }
+    if (prior == size) {
+        return data;
+    }
+    if (!reportError) {
+        return data.subdata(prior);
+    }
+    Error error;
+    error.level = m_errorIgnorable ? Error::Level::Warning : Error::Level::Error;
+    error.setSystemCode(EIO, Error::Code::IOError, "Short read.");
+    error.infos.insert_or_assign(ErrorStringKeyAssociatePath, path);
+    Notifier::shared().notify(error);
+    SharedThreadedErrorProne::setThreadedError(std::move(error));
+    return data.subdata(prior);
+}
+
 bool FileHandle::write(const UnsafeData &unsafeData)
 {
     WCTAssert(isOpened());
@@ -209,10 +279,12 @@ bool FileHandle::write(const UnsafeData &unsafeData)
     ssize_t prior = 0;
     size_t size = unsafeData.size();
     const unsigned char *buffer = unsafeData.buffer();
-    offset_t offset = (offset_t) wcdb_lseek(m_fd, 0, SEEK_SET);
-    if (offset != 0) {
-        setThreadedError();
-        return false;
+    if (m_mode != Mode::Append) {
+        offset_t offset = (offset_t) wcdb_lseek(m_fd, 0, SEEK_SET);
+        if (offset != 0) {
+            setThreadedError();
+            return false;
+        }
     }
     do {
         wrote = ::write(m_fd, buffer, size);
@@ -233,7 +305,7 @@ bool FileHandle::write(const UnsafeData &unsafeData)
         }
     } while (wrote > 0);
     if (wrote + prior == unsafeData.size()) {
-        m_fileSize = unsafeData.size();
+        m_fileSize = m_mode != Mode::Append ? (ssize_t) unsafeData.size() : -1;
         return true;
     }
     m_fileSize = -1;
@@ -246,6 +318,24 @@ bool FileHandle::write(const UnsafeData &unsafeData)
     return false;
 }
 
+void FileHandle::adviseReadahead(offset_t offset, size_t size)
+{
+    WCTAssert(isOpened());
+#if defined(__APPLE__)
+    struct radvisory advisory;
+    advisory.ra_offset = (off_t) offset;
+    advisory.ra_count = (int) size;
+    int ret = fcntl(m_fd, F_RDADVISE, &advisory);
+    WCDB_UNUSED(ret);
+#elif defined(__linux__)
+    int ret = posix_fadvise(m_fd, (off_t) offset, (off_t) size, POSIX_FADV_WILLNEED);
+    WCDB_UNUSED(ret);
+#else
+    WCDB_UNUSED(offset);
+    WCDB_UNUSED(size);
+#endif
+}
+
 #pragma mark - Memory map
 MappedData FileHandle::map(offset_t offset, size_t length, SharedHighWater highWater)
 {
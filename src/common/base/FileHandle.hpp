@@ -58,13 +58,23 @@ public:
         None = 0,
         OverWrite = 1,
         ReadOnly = 2,
+        // every write is appended to the end of file, which is used by logs.
+        Append = 3,
     };
     bool open(Mode mode);
     bool isOpened() const;
     void close();
     ssize_t size();
     Data read(size_t size);
+    // positional read, which doesn't change the offset of file and is thread-safe.
+    // The failure of speculative read can be left unreported by passing false to reportError.
+    Data read(offset_t offset,
+              size_t size,
+              SharedHighWater highWater = nullptr,
+              bool reportError = true);
     bool write(const UnsafeData &unsafeData);
+    // hint the system to read the range asynchronously ahead of the coming reads.
+    void adviseReadahead(offset_t offset, size_t size);
 
 protected:
     int m_mode;
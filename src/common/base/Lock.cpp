@@ -26,6 +26,8 @@
 #include "Assertion.hpp"
 #include "CrossPlatform.h"
 #include <condition_variable>
+#include <memory>
+#include <new>
 
 namespace WCDB {
 
@@ -51,58 +53,105 @@ void Conditional::notify(const Thread &thread)
 
 #pragma mark - Shared Lock
 SharedLock::SharedLock()
-: m_readers(0), m_writers(0), m_pendingReaders(0), m_threadedReaders(0)
+: m_writers(0), m_pendingReaders(0), m_threadedReaders(0), m_writing(0)
 {
+    static_assert(sizeof(Stripe) == cacheLineSize && alignof(Stripe) == cacheLineSize, "");
+    void *buffer = m_stripesBuffer;
+    size_t space = sizeof(m_stripesBuffer);
+    buffer = std::align(cacheLineSize, sizeof(Stripe) * numberOfStripes, buffer, space);
+    WCTAssert(buffer != nullptr);
+    m_stripes = reinterpret_cast<Stripe *>(buffer);
+    for (int i = 0; i < numberOfStripes; ++i) {
+        new (&m_stripes[i]) Stripe();
+        m_stripes[i].readers.store(0, std::memory_order_relaxed);
+    }
 }
 
 SharedLock::~SharedLock()
 {
     WCTRemedialAssert(m_writers == 0 && m_pendingWriters.size() == 0, "Unpaired lock", ;);
-    WCTRemedialAssert(m_readers == 0 && m_pendingReaders == 0, "Unpaired shared lock", ;);
+    WCTRemedialAssert(numberOfReaders() == 0 && m_pendingReaders == 0, "Unpaired shared lock", ;);
+}
+
+SharedLock::Stripe &SharedLock::stripeOfCurrentThread(Stripe *stripes)
+{
+    static std::atomic<unsigned int> *s_nextStripe = new std::atomic<unsigned int>(0);
+    thread_local int s_stripe = (int) (s_nextStripe->fetch_add(1) % numberOfStripes);
+    return stripes[s_stripe];
+}
+
+int SharedLock::numberOfReaders() const
+{
+    int readers = 0;
+    for (int i = 0; i < numberOfStripes; ++i) {
+        readers += m_stripes[i].readers.load();
+    }
+    return readers;
 }
 
 void SharedLock::lockShared()
+{
+    int &threadedReaders = m_threadedReaders.getOrCreate();
+    Stripe &stripe = stripeOfCurrentThread(m_stripes);
+    // The order of increasing the stripe and checking the writing matters.
+    // Writers do the opposite, so that at least one of them will see the other one.
+    stripe.readers.fetch_add(1);
+    if (m_writing.load() == 0 || threadedReaders > 0) {
+        // it's not locked and no one is pending to lock
+        // or it's already shared locked by current thread
+        ++threadedReaders;
+        return;
+    }
+    stripe.readers.fetch_sub(1);
+    lockSharedSlowly(threadedReaders);
+}
+
+void SharedLock::lockSharedSlowly(int &threadedReaders)
 {
     std::unique_lock<std::mutex> lockGuard(m_lock);
-    if (m_writers > 0 ?
-        !m_locking.isCurrentThread() :
-        (m_pendingWriters.size() > 0 && m_threadedReaders.getOrCreate() == 0)) {
+    // A pending writer might be waiting for the stripe that is just released.
+    notifyWriters();
+    if (m_writing.load() > 0 && !m_locking.isCurrentThread()) {
         // If it is locked but not current thread, it should wait for the write lock.
-        // If it is not locked but there is someone pending to lock and current thread is not already shared locked, it should wait for the pending lock to avoid the pending lock starve.
+        // If it is not locked but there is someone pending to lock, it should wait for the pending lock to avoid the pending lock starve.
         ++m_pendingReaders;
         do {
             m_conditionalReaders.wait(lockGuard);
-        } while (m_writers > 0 || m_pendingWriters.size() > 0);
+        } while (m_writing.load() > 0);
         --m_pendingReaders;
     }
     // it's already locked by current thread
-    // or it's already shared locked by current thread
     // or it's not locked
-    WCTAssert(m_locking.isCurrentThread() || m_threadedReaders.getOrCreate() > 0
-              || m_writers == 0);
-    ++m_readers;
-    ++m_threadedReaders.getOrCreate();
+    // Writers check the readers with the mutex held, so it's safe to increase it without checking again.
+    WCTAssert(m_locking.isCurrentThread() || m_writers == 0);
+    stripeOfCurrentThread(m_stripes).readers.fetch_add(1);
+    ++threadedReaders;
 }
 
 void SharedLock::unlockShared()
 {
-    int &threadedReader = m_threadedReaders.getOrCreate();
-    WCTRemedialAssert(threadedReader > 0, "Unpaired unlock shared.", return;);
-    WCTAssert(threadedReader > 0);
+    int &threadedReaders = m_threadedReaders.getOrCreate();
+    WCTRemedialAssert(threadedReaders > 0, "Unpaired unlock shared.", return;);
+    WCTAssert(threadedReaders > 0);
 
-    std::unique_lock<std::mutex> lockGuard(m_lock);
-    WCTAssert(m_readers > 0);
-    --threadedReader;
-    --m_readers;
-    if (m_readers == 0) {
-        WCTAssert(m_threadedReaders.getOrCreate() == 0);
-        if (m_writers == 0 && m_pendingWriters.size() > 0) {
+    --threadedReaders;
+    int readers = stripeOfCurrentThread(m_stripes).readers.fetch_sub(1);
+    WCTAssert(readers > 0);
+    WCDB_UNUSED(readers);
+    if (m_writing.load() > 0) {
+        std::unique_lock<std::mutex> lockGuard(m_lock);
+        notifyWriters();
+    }
+}
+
+void SharedLock::notifyWriters()
+{
+    if (m_writers == 0 && m_pendingWriters.size() > 0) {
 #ifdef __APPLE__
-            m_conditionalWriters.notify(m_pendingWriters.front());
+        m_conditionalWriters.notify(m_pendingWriters.front());
 #else
-            m_conditionalWriters.notify_all();
+        m_conditionalWriters.notify_all();
 #endif
-        }
     }
 }
 
@@ -115,7 +164,9 @@ void SharedLock::lock()
     std::unique_lock<std::mutex> lockGuard(m_lock);
     if (!m_locking.equal(current)) {
         m_pendingWriters.emplace(current);
-        while (m_readers > 0 || m_writers > 0 || !m_pendingWriters.front().equal(current)) {
+        m_writing.fetch_add(1);
+        while (m_writers > 0 || !m_pendingWriters.front().equal(current)
+               || numberOfReaders() > 0) {
             m_conditionalWriters.wait(lockGuard);
         }
         WCTAssert(m_pendingWriters.front().isCurrentThread());
@@ -123,7 +174,7 @@ void SharedLock::lock()
     }
     // it's already locked by current thread
     // or it's not locked and it's not shared locked
-    WCTAssert(m_locking.isCurrentThread() || (m_writers == 0 && m_readers == 0));
+    WCTAssert(m_locking.isCurrentThread() || m_writers == 0);
     ++m_writers;
     m_locking = Thread::current();
 }
@@ -140,17 +191,13 @@ void SharedLock::unlock()
 
     std::unique_lock<std::mutex> lockGuard(m_lock);
     WCTRemedialAssert(m_locking.isCurrentThread(), "Unpaired unlock.", return;);
-    WCTAssert(m_readers == 0);
     WCTAssert(m_writers > 0);
     if (--m_writers == 0) {
         m_locking = nullptr;
+        m_writing.fetch_sub(1);
         // write lock first
         if (m_pendingWriters.size() > 0) {
-#ifdef __APPLE__
-            m_conditionalWriters.notify(m_pendingWriters.front());
-#else
-            m_conditionalWriters.notify_all();
-#endif
+            notifyWriters();
         } else if (m_pendingReaders > 0) {
             m_conditionalReaders.notify_all();
         }
@@ -48,6 +48,10 @@ public:
 // TODO:
 // std::shared_timed_mutex is supported since iOS 10 and macOS 10.12.
 // std::shared_mutex is supported in a more recent version.
+// Readers are counted in striped counters without the mutex as long as there is no writer,
+// so that read-mostly paths don't serialize on a single cache line.
+// Writers are preferred. Once a writer is pending, new readers fall back to wait on the mutex,
+// except the reentrant ones.
 class SharedLock final {
 public:
     typedef std::function<void(void)> PendingCallback;
@@ -71,16 +75,36 @@ public:
     bool writeSafety() const;
 
 protected:
+    void lockSharedSlowly(int &threadedReaders);
+    void notifyWriters();
+    int numberOfReaders() const;
+
     mutable std::mutex m_lock;
     Conditional m_conditionalReaders;
     Conditional m_conditionalWriters;
-    int m_readers;
     int m_writers;
     int m_pendingReaders;
     std::queue<Thread> m_pendingWriters;
     Thread m_locking;
     // mutable since it can be only modified threaded
     mutable ThreadLocal<int> m_threadedReaders;
+
+#pragma mark - Stripe
+protected:
+    static constexpr const int numberOfStripes = 16;
+    static constexpr const int cacheLineSize = 64;
+    // Each stripe takes a whole cache line to avoid false sharing.
+    struct alignas(cacheLineSize) Stripe {
+        std::atomic<int> readers;
+    };
+    static Stripe &stripeOfCurrentThread(Stripe *stripes);
+
+    // Heap allocation doesn't respect the alignment beyond max_align_t before C++17,
+    // so the stripes are aligned to the cache line manually within a buffer that has one more line.
+    unsigned char m_stripesBuffer[cacheLineSize * (numberOfStripes + 1)];
+    Stripe *m_stripes;
+    // Number of the pending and running writers. Readers take the fast path only when it's 0.
+    std::atomic<int> m_writing;
 };
 
 #pragma mark - Lock Guard
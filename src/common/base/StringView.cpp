@@ -73,7 +73,7 @@ UnsafeStringView::UnsafeStringView(const UnsafeStringView& other)
     }
 }
 
-UnsafeStringView::UnsafeStringView(UnsafeStringView&& other)
+UnsafeStringView::UnsafeStringView(UnsafeStringView&& other) noexcept
 : m_data(other.m_data), m_length(other.m_length), m_referenceCount(other.m_referenceCount)
 {
     other.m_referenceCount = nullptr;
@@ -102,7 +102,7 @@ UnsafeStringView& UnsafeStringView::operator=(const UnsafeStringView& other)
     return *this;
 }
 
-UnsafeStringView& UnsafeStringView::operator=(UnsafeStringView&& other)
+UnsafeStringView& UnsafeStringView::operator=(UnsafeStringView&& other) noexcept
 {
     m_data = other.m_data;
     m_length = other.m_length;
@@ -48,10 +48,10 @@ public:
     UnsafeStringView(const char* string, size_t length);
 
     UnsafeStringView(const UnsafeStringView& other);
-    UnsafeStringView(UnsafeStringView&& other);
+    UnsafeStringView(UnsafeStringView&& other) noexcept;
 
     UnsafeStringView& operator=(const UnsafeStringView& other);
-    UnsafeStringView& operator=(UnsafeStringView&& other);
+    UnsafeStringView& operator=(UnsafeStringView&& other) noexcept;
     bool operator==(const UnsafeStringView& other) const;
     bool operator!=(const UnsafeStringView& other) const;
     bool operator<(const UnsafeStringView& other) const;
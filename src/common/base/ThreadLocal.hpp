@@ -25,61 +25,134 @@
 #pragma once
 
 #include <atomic>
-#include <map>
+#include <cstdint>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 namespace WCDB {
 
 template<typename T>
 class UntypedThreadLocal {
 protected:
+    // Identifier is the index of slot in the per-thread storage, which is recycled after the thread local is destructed.
     typedef unsigned int Identifier;
-    static Identifier nextIdentifier()
+    // Serial is unique among all the thread locals, so that the slot left by the destructed one can be told from others.
+    typedef uint64_t Serial;
+
+    struct Slot {
+        Serial serial = 0;
+        std::unique_ptr<T> value;
+    };
+    typedef std::vector<Slot> Slots;
+
+    static Serial nextSerial()
     {
-        static std::atomic<Identifier>* s_identifier = new std::atomic<Identifier>(0);
-        return ++(*s_identifier);
+        static std::atomic<Serial>* s_serial = new std::atomic<Serial>(0);
+        return ++(*s_serial);
     }
-    static std::map<Identifier, T>& threadedStorage()
+
+    static Identifier acquireIdentifier()
     {
-        thread_local std::unique_ptr<std::map<Identifier, T>> s_storage(
-        new std::map<Identifier, T>());
-        return *s_storage;
+        Identifiers& identifiers = sharedIdentifiers();
+        std::lock_guard<std::mutex> lockGuard(identifiers.lock);
+        if (!identifiers.recycled.empty()) {
+            Identifier identifier = identifiers.recycled.back();
+            identifiers.recycled.pop_back();
+            return identifier;
+        }
+        return identifiers.next++;
+    }
+
+    static void recycleIdentifier(Identifier identifier)
+    {
+        Identifiers& identifiers = sharedIdentifiers();
+        std::lock_guard<std::mutex> lockGuard(identifiers.lock);
+        identifiers.recycled.push_back(identifier);
+    }
+
+    static Slots& threadedSlots()
+    {
+        thread_local std::unique_ptr<Slots> s_slots(new Slots());
+        return *s_slots;
+    }
+
+private:
+    struct Identifiers {
+        std::mutex lock;
+        Identifier next = 0;
+        std::vector<Identifier> recycled;
+    };
+
+    static Identifiers& sharedIdentifiers()
+    {
+        static Identifiers* s_identifiers = new Identifiers();
+        return *s_identifiers;
     }
 };
 
 template<typename T>
 class ThreadLocal : public UntypedThreadLocal<T> {
 public:
-    using UntypedThreadLocal<T>::nextIdentifier;
-    using UntypedThreadLocal<T>::threadedStorage;
+    using UntypedThreadLocal<T>::nextSerial;
+    using UntypedThreadLocal<T>::acquireIdentifier;
+    using UntypedThreadLocal<T>::recycleIdentifier;
+    using UntypedThreadLocal<T>::threadedSlots;
     using Identifier = typename UntypedThreadLocal<T>::Identifier;
+    using Serial = typename UntypedThreadLocal<T>::Serial;
+    using Slot = typename UntypedThreadLocal<T>::Slot;
     ThreadLocal(const typename std::enable_if<std::is_default_constructible<T>::value>::type* = nullptr)
-    : m_identifier(nextIdentifier()), m_default()
+    : m_identifier(acquireIdentifier()), m_serial(nextSerial()), m_default()
     {
     }
 
     ThreadLocal(const T& defaultValue)
-    : m_identifier(nextIdentifier()), m_default(defaultValue)
+    : m_identifier(acquireIdentifier()), m_serial(nextSerial()), m_default(defaultValue)
     {
     }
 
     ThreadLocal(T&& defaultValue)
-    : m_identifier(nextIdentifier()), m_default(std::move(defaultValue))
+    : m_identifier(acquireIdentifier()), m_serial(nextSerial()), m_default(std::move(defaultValue))
     {
     }
 
+    // The storage of other threads can't be touched here.
+    // Their values are released when the identifier is reused by them, or when they exit.
+    ~ThreadLocal() { recycleIdentifier(m_identifier); }
+
+    ThreadLocal(const ThreadLocal&) = delete;
+    ThreadLocal& operator=(const ThreadLocal&) = delete;
+
     T& getOrCreate()
     {
-        auto& storage = threadedStorage();
-        auto iter = storage.find(m_identifier);
-        if (iter == storage.end()) {
-            iter = storage.emplace(m_identifier, m_default).first;
+        auto& slots = threadedSlots();
+        if (m_identifier < slots.size()) {
+            Slot& slot = slots[m_identifier];
+            if (slot.serial == m_serial) {
+                return *slot.value;
+            }
         }
-        return *(&iter->second);
+        return create();
     }
 
 private:
+    T& create()
+    {
+        std::unique_ptr<T> value(new T(m_default));
+        T& created = *value;
+        auto& slots = threadedSlots();
+        if (m_identifier >= slots.size()) {
+            slots.resize(m_identifier + 1);
+        }
+        Slot& slot = slots[m_identifier];
+        slot.serial = m_serial;
+        // The stale value, if any, is released after the slot is settled since its destructor might access thread locals.
+        value.swap(slot.value);
+        return created;
+    }
+
     const Identifier m_identifier;
+    const Serial m_serial;
     const T m_default;
 };
 
@@ -291,7 +291,17 @@ void CommonCore::checkpointShouldBeOperated(const UnsafeStringView& path)
 {
     RecyclableDatabase database = m_databasePool.getOrCreate(path);
     if (database != nullptr) {
-        database->checkpoint(true);
+        AutoCheckpointConfig* checkpointConfig
+        = dynamic_cast<AutoCheckpointConfig*>(m_autoCheckpointConfig.get());
+        WCTAssert(checkpointConfig != nullptr);
+        if (checkpointConfig == nullptr) {
+            database->checkpoint(true);
+            return;
+        }
+        InnerDatabase::CheckPointMode mode = checkpointConfig->getCheckpointMode(path);
+        InnerDatabase::CheckPointResult result;
+        bool succeed = database->checkpoint(true, mode, &result);
+        checkpointConfig->checkpointDidFinish(path, mode, succeed, result);
     }
 }
 
@@ -365,6 +375,16 @@ void CommonCore::setNotificationWhenDatabaseCorrupted(const UnsafeStringView& pa
     m_operationQueue->setNotificationWhenCorrupted(path, underlyingNotification);
 }
 
+void CommonCore::setNumberOfOperationWorkers(int numberOfWorkers)
+{
+    m_operationQueue->setNumberOfWorkers(numberOfWorkers);
+}
+
+OperationQueue::Statistics CommonCore::getOperationQueueStatistics()
+{
+    return m_operationQueue->getStatistics();
+}
+
 #pragma mark - Checkpoint
 void CommonCore::enableAutoCheckpoint(InnerDatabase* database, bool enable)
 {
@@ -389,6 +409,17 @@ void CommonCore::setCheckPointMinFrames(int frames)
     }
 }
 
+AutoCheckpointConfig::Statistics CommonCore::getCheckpointStatistics(const UnsafeStringView& path)
+{
+    AutoCheckpointConfig* checkpointConfig
+    = dynamic_cast<AutoCheckpointConfig*>(m_autoCheckpointConfig.get());
+    WCTAssert(checkpointConfig != nullptr);
+    if (checkpointConfig != nullptr) {
+        return checkpointConfig->getStatistics(path);
+    }
+    return AutoCheckpointConfig::Statistics();
+}
+
 #pragma mark - Backup
 void CommonCore::enableAutoBackup(InnerDatabase* database, bool enable)
 {
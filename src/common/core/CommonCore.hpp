@@ -114,6 +114,8 @@ public:
     bool isFileObservedCorrupted(const UnsafeStringView& path);
     void setNotificationWhenDatabaseCorrupted(const UnsafeStringView& path,
                                               const CorruptedNotification& notification);
+    void setNumberOfOperationWorkers(int numberOfWorkers);
+    OperationQueue::Statistics getOperationQueueStatistics();
 
 protected:
     Optional<bool> migrationShouldBeOperated(const UnsafeStringView& path) override final;
@@ -129,6 +131,7 @@ protected:
 public:
     void enableAutoCheckpoint(InnerDatabase* database, bool enable);
     void setCheckPointMinFrames(int frames);
+    AutoCheckpointConfig::Statistics getCheckpointStatistics(const UnsafeStringView& path);
 
 private:
     std::shared_ptr<Config> m_autoCheckpointConfig;
@@ -62,10 +62,16 @@ WCDBLiteralStringImplement(ScalarFunctionConfigPrefix);
 
 WCDBLiteralStringImplement(AutoVacuumConfigName);
 
+WCDBLiteralStringImplement(PreparedStatementCacheConfigName);
+
 WCDBLiteralStringImplement(NotifierPreprocessorName);
 
 WCDBLiteralStringImplement(NotifierLoggerName);
 
+WCDBLiteralStringImplement(CompressionWorkerPoolName);
+
+WCDBLiteralStringImplement(RepairWorkerPoolName);
+
 WCDBLiteralStringImplement(ErrorStringKeyType);
 WCDBLiteralStringImplement(ErrorStringKeySource);
 WCDBLiteralStringImplement(ErrorStringKeyPath);
@@ -46,6 +46,9 @@ static constexpr const double OperationQueueTimeIntervalForPurgingAgain = 30.0;
 static constexpr const double OperationQueueRateForTooManyFileDescriptors = 0.7;
 #pragma mark - Operation Queue - Checkpoint
 static constexpr const double OperationQueueTimeIntervalForCheckpoint = 10.0;
+static constexpr const double OperationQueueTimeIntervalForUrgentCheckpoint = 1.0;
+static constexpr const double OperationQueueTimeIntervalForIdleCheckpoint = 30.0;
+static constexpr const double OperationQueueMaxTimeIntervalForCheckpoint = 600.0;
 #pragma mark - Operation Queue - Backup
 #ifndef WCDB_QUICK_TESTS
 static double OperationQueueTimeIntervalForBackup = 600.0;
@@ -55,9 +58,22 @@ static double OperationQueueTimeIntervalForBackup = 10.0;
 #pragma mark - Operation Queue - Merge FTS Index
 static constexpr const double OperationQueueTimeIntervalForMergeFTSIndex
 = 1.871; //Use prime numbers to reduce the probability of collision with external logic
+#pragma mark - Operation Queue - Worker
+static constexpr const int OperationQueueDefaultNumberOfWorkers = 2;
+static constexpr const int OperationQueueMaxNumberOfWorkers = 8;
 
 #pragma mark - Config - Auto Checkpoint
 WCDBLiteralStringDefine(AutoCheckpointConfigName, "com.Tencent.WCDB.Config.AutoCheckpoint");
+// Frames are pages, so 10000 frames is about 40MB wal with the default page size.
+static constexpr const int AutoCheckpointFramesForFull = 10000;
+static constexpr const int AutoCheckpointFramesForTruncate = 100000;
+static constexpr const int AutoCheckpointMaxFramesForIdle = 100;
+static constexpr const double AutoCheckpointFrameRateForBurst = 1000.0; // frames per second
+static constexpr const double AutoCheckpointFrameRateWindow = 1.0; // seconds
+static constexpr const int AutoCheckpointBlockedTimesToEscalate = 2;
+// Checkpoints other than passive wait for readers while holding the writer lock,
+// so the waiting of background ones is limited to avoid stalling the writes.
+static constexpr const double AutoCheckpointBusyTimeOut = 0.5; // seconds
 #pragma mark - Config - Auto Backup
 WCDBLiteralStringDefine(AutoBackupConfigName, "com.Tencent.WCDB.Config.AutoBackup");
 #pragma mark - Config - Auto Migrate
@@ -96,6 +112,9 @@ WCDBLiteralStringDefine(AuxiliaryFunctionConfigPrefix,
                         "com.Tencent.WCDB.Config.AuxiliaryFunction.");
 #pragma mark - Config - AutoVaccum
 WCDBLiteralStringDefine(AutoVacuumConfigName, "com.Tencent.WCDB.Config.AutoVaccum");
+#pragma mark - Config - Prepared Statement Cache
+WCDBLiteralStringDefine(PreparedStatementCacheConfigName,
+                        "com.Tencent.WCDB.Config.PreparedStatementCache");
 
 #pragma mark - Notifier
 WCDBLiteralStringDefine(NotifierPreprocessorName, "com.Tencent.WCDB.Notifier.PreprocessTag");
@@ -111,6 +130,7 @@ enum HandleSlot : unsigned char {
     HandleSlotAssemble,
     HandleSlotVacuum,
     HandleSlotCipher,
+    HandleSlotWriter,
     HandleSlotCount,
 };
 
@@ -130,6 +150,7 @@ enum HandleCategory : unsigned char {
 
 enum class HandleType : unsigned int {
     Normal = (HandleCategoryNormal << 8) | HandleSlotNormal,
+    NormalWriter = (HandleCategoryNormal << 8) | HandleSlotWriter,
     Migrate = (HandleCategoryMigrate << 8) | HandleSlotAutoTask,
     Compress = (HandleCategoryCompress << 8) | HandleSlotAutoTask,
     BackupCipher = (HandleCategoryCipher << 8) | HandleSlotCipher,
@@ -155,25 +176,44 @@ static constexpr HandleCategory categoryOfHandleType(HandleType type)
 }
 static constexpr bool handleShouldWaitWhenFull(HandleType type)
 {
-    return type == HandleType::Normal;
+    return type == HandleType::Normal || type == HandleType::NormalWriter;
 }
 
 #pragma mark - Backup
 static constexpr const int BackupMaxIncrementalTimes = 1000;
 static constexpr const int BackupMaxIncrementalPageCount = 1000;
 static constexpr const int BackupMaxAllowIncrementalPageCount = 1000000;
+static constexpr const int BackupMaxMaterialLogSizePercentage = 50;
+
+#pragma mark - Repair
+static constexpr const int RepairMaxNumberOfWorkers = 4;
+WCDBLiteralStringDefine(RepairWorkerPoolName, "WCDB.Repair");
+static constexpr const int RepairMinNumberOfPagesToPrefetch = 8;
+static constexpr const size_t RepairMaxNumberOfPrefetchedPages = 256;
+static constexpr const size_t RepairMaxNumberOfPagesPerPrefetch = 16;
 
 #pragma mark - Migrate
 static constexpr const double MigrateMaxExpectingDuration = 0.01;
 static constexpr const double MigrateMaxInitializeDuration = 0.005;
+static constexpr const int MigrateBatchCount = 16;
+static constexpr const int MigrateMaxBatchCount = 4096;
 
 #pragma mark - Compression
 static constexpr const int CompressionBatchCount = 10;
+static constexpr const int CompressionMaxBatchCount = 1000;
+static constexpr const double CompressionMaxExpectingDuration = 0.01;
+static constexpr const int CompressionMaxNumberOfWorkers = 4;
+WCDBLiteralStringDefine(CompressionWorkerPoolName, "WCDB.Compression");
+static constexpr const int CompressionMinRowCountPerWorker = 8;
 static constexpr const int CompressionUpdateRecordBatchCount = 1000;
 
 #pragma mark - Vacuum
 static constexpr const int VacuumBatchCount = 1000;
 
+#pragma mark - Group Commit
+static constexpr const double GroupCommitDefaultWindow = 0;
+static constexpr const int GroupCommitDefaultMaxNumberOfTransactions = 128;
+
 WCDBLiteralStringDefine(ErrorStringKeyType, "Type");
 WCDBLiteralStringDefine(ErrorStringKeySource, "Source")
 
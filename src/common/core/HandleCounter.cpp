@@ -28,60 +28,112 @@
 
 namespace WCDB {
 
-HandleCounter::HandleCounter() : m_writerCount(0), m_totalCount(0)
+static constexpr const int64_t HandleCounterTotalUnit = 1;
+static constexpr const int64_t HandleCounterWriterUnit = (int64_t) 1 << 32;
+
+HandleCounter::HandleCounter()
+: m_counts(0), m_pendingCount(0), m_maxAllowedNumberOfWriters(HandlePoolMaxAllowedNumberOfWriters)
 {
 }
 
 HandleCounter::~HandleCounter() = default;
 
-bool HandleCounter::tryIncreaseHandleCount(HandleType type, bool writeHint)
+int HandleCounter::totalCountOf(int64_t counts)
+{
+    return (int) (counts & 0xffffffff);
+}
+
+int HandleCounter::writerCountOf(int64_t counts)
+{
+    return (int) (counts >> 32);
+}
+
+void HandleCounter::setMaxAllowedNumberOfWriters(int maxAllowedNumberOfWriters)
 {
+    WCTAssert(maxAllowedNumberOfWriters > 0
+              && maxAllowedNumberOfWriters <= HandlePoolMaxAllowedNumberOfWriters);
     std::unique_lock<std::mutex> lockGuard(m_lock);
-    while (m_totalCount >= HandlePoolMaxAllowedNumberOfHandles
-           || (writeHint && m_writerCount >= HandlePoolMaxAllowedNumberOfWriters)) {
-        while (m_totalCount >= HandlePoolMaxAllowedNumberOfHandles) {
-            if (!handleShouldWaitWhenFull(type)) {
-                return false;
-            }
-            m_pendingNormals.emplace(Thread::current());
-            m_conditionalNormals.wait(lockGuard);
-            m_pendingNormals.pop();
+    m_maxAllowedNumberOfWriters = maxAllowedNumberOfWriters;
+    notifyPendings();
+}
+
+bool HandleCounter::tryIncreaseWithoutWaiting(bool writeHint)
+{
+    int64_t increment
+    = writeHint ? HandleCounterWriterUnit + HandleCounterTotalUnit : HandleCounterTotalUnit;
+    int maxAllowedNumberOfWriters = m_maxAllowedNumberOfWriters.load();
+    int64_t counts = m_counts.load();
+    do {
+        if (totalCountOf(counts) >= HandlePoolMaxAllowedNumberOfHandles
+            || (writeHint && writerCountOf(counts) >= maxAllowedNumberOfWriters)) {
+            return false;
         }
-        while (writeHint && m_writerCount >= HandlePoolMaxAllowedNumberOfWriters) {
-            if (!handleShouldWaitWhenFull(type)) {
-                return false;
-            }
-            m_pendingWriters.emplace(Thread::current());
+    } while (!m_counts.compare_exchange_weak(counts, counts + increment));
+    return true;
+}
+
+bool HandleCounter::tryIncreaseHandleCount(HandleType type, bool writeHint)
+{
+    // Fast path. Let the pending threads go first to avoid starvation.
+    if (m_pendingCount.load() == 0 && tryIncreaseWithoutWaiting(writeHint)) {
+        return true;
+    }
+
+    std::unique_lock<std::mutex> lockGuard(m_lock);
+    if (!handleShouldWaitWhenFull(type)) {
+        return tryIncreaseWithoutWaiting(writeHint);
+    }
+    // The pending count must be increased before the counts are checked again,
+    // so that decreaseHandleCount can always see the pending thread.
+    ++m_pendingCount;
+    if (writeHint) {
+        // Writers are satisfied in FIFO order.
+        Thread current = Thread::current();
+        m_pendingWriters.emplace(current);
+        while (!m_pendingWriters.front().equal(current) || !tryIncreaseWithoutWaiting(true)) {
             m_conditionalWriters.wait(lockGuard);
-            m_pendingWriters.pop();
         }
+        m_pendingWriters.pop();
+    } else {
+        m_pendingNormals.emplace(Thread::current());
+        while (!tryIncreaseWithoutWaiting(false)) {
+            m_conditionalNormals.wait(lockGuard);
+        }
+        m_pendingNormals.pop();
     }
+    --m_pendingCount;
     if (writeHint) {
-        m_writerCount++;
+        // The next writer may also be allowed.
+        notifyPendings();
     }
-    m_totalCount++;
     return true;
 }
 
 void HandleCounter::decreaseHandleCount(bool writeHint)
 {
-    bool hasNotified = false;
+    int64_t decrement
+    = writeHint ? HandleCounterWriterUnit + HandleCounterTotalUnit : HandleCounterTotalUnit;
+    int64_t counts = m_counts.fetch_sub(decrement) - decrement;
+    WCTAssert(totalCountOf(counts) >= 0);
+    WCTAssert(writerCountOf(counts) >= 0);
+    WCDB_UNUSED(counts);
+    if (m_pendingCount.load() == 0) {
+        return;
+    }
     std::unique_lock<std::mutex> lockGuard(m_lock);
-    if (writeHint) {
-        m_writerCount--;
-        WCTAssert(m_writerCount >= 0);
-        if (m_pendingWriters.size() > 0) {
+    notifyPendings();
+}
+
+void HandleCounter::notifyPendings()
+{
+    if (m_pendingWriters.size() > 0) {
 #ifdef __APPLE__
-            m_conditionalWriters.notify(m_pendingWriters.front());
+        m_conditionalWriters.notify(m_pendingWriters.front());
 #else
-            m_conditionalWriters.notify_all();
+        m_conditionalWriters.notify_all();
 #endif
-            hasNotified = true;
-        }
     }
-    m_totalCount--;
-    WCTAssert(m_totalCount >= 0);
-    if (!hasNotified && m_pendingNormals.size() > 0) {
+    if (m_pendingNormals.size() > 0) {
 #ifdef __APPLE__
         m_conditionalNormals.notify(m_pendingNormals.front());
 #else
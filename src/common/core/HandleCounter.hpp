@@ -42,6 +42,13 @@ namespace WCDB {
  *
  * When the number limit is exceeded, the handle counter will let the thread
  * that acquires the handle wait in place until other handles are recycled.
+ *
+ * In single writer mode, only 1 handle can exist for writing and the threads
+ * pending for writing will be satisfied in FIFO order.
+ *
+ * Both counts are packed into one atomic integer, so that the common case,
+ * which is under the limits and without any pending thread, is lock-free.
+ * The mutex and conditions are only used when the limits are hit.
  */
 
 class HandleCounter {
@@ -54,14 +61,23 @@ public:
     bool tryIncreaseHandleCount(HandleType type, bool writeHint);
     void decreaseHandleCount(bool writeHint);
 
+    void setMaxAllowedNumberOfWriters(int maxAllowedNumberOfWriters);
+
 private:
+    bool tryIncreaseWithoutWaiting(bool writeHint);
+    void notifyPendings();
+    static int totalCountOf(int64_t counts);
+    static int writerCountOf(int64_t counts);
+
     mutable std::mutex m_lock;
     Conditional m_conditionalNormals;
     Conditional m_conditionalWriters;
     std::queue<Thread> m_pendingNormals;
     std::queue<Thread> m_pendingWriters;
-    int m_writerCount = 0;
-    int m_totalCount = 0;
+    // The lower 32 bits is the total count and the upper 32 bits is the writer count.
+    std::atomic<int64_t> m_counts;
+    std::atomic<int> m_pendingCount;
+    std::atomic<int> m_maxAllowedNumberOfWriters;
 };
 
 } // namespace WCDB
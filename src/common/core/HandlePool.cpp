@@ -98,7 +98,8 @@ void HandlePool::clearAllHandles()
     WCTAssert(m_concurrency.writeSafety());
     WCTAssert(m_memory.writeSafety());
     for (unsigned int i = 0; i < HandleSlotCount; ++i) {
-        m_frees[i].clear();
+        while (m_frees[i].pop() != nullptr)
+            ;
         auto &handles = m_handles[i];
         for (const auto &handle : handles) {
             handle->close();
@@ -113,13 +114,18 @@ void HandlePool::purge()
     SharedLockGuard concurrencyGuard(m_concurrency);
     LockGuard memoryGuard(m_memory);
     for (unsigned int i = 0; i < HandleSlotCount; ++i) {
-        auto &handles = m_handles[i];
-        auto &frees = m_frees[i];
-        for (const auto &handle : frees) {
-            handle->close();
-            handles.erase(handle);
-        }
-        frees.clear();
+        closeFreeHandles((HandleSlot) i);
+    }
+}
+
+void HandlePool::closeFreeHandles(HandleSlot slot)
+{
+    WCTAssert(m_memory.writeSafety());
+    auto &handles = m_handles[slot];
+    std::shared_ptr<InnerHandle> handle;
+    while ((handle = m_frees[slot].pop()) != nullptr) {
+        handle->close();
+        handles.erase(handle);
     }
 }
 
@@ -160,6 +166,11 @@ const std::set<std::shared_ptr<InnerHandle>> &HandlePool::getHandlesOfSlot(Handl
     return m_handles[slot];
 }
 
+void HandlePool::setMaxAllowedNumberOfWriters(int maxAllowedNumberOfWriters)
+{
+    m_counter.setMaxAllowedNumberOfWriters(maxAllowedNumberOfWriters);
+}
+
 size_t HandlePool::numberOfAliveHandlesInSlot(HandleSlot slot) const
 {
     SharedLockGuard concurrencyGuard(m_concurrency);
@@ -177,6 +188,9 @@ RecyclableHandle HandlePool::flowOut(HandleType type, bool writeHint)
     ReferencedHandle &referencedHandle = m_threadedHandles.getOrCreate().at(category);
     {
         // threaded handles is thread safe.
+        // Note that a write request is also served by the handle that this thread is holding
+        // for reading, even in single writer mode. Waiting for the writer handle here may deadlock
+        // when the holding handle is in a transaction.
         if (referencedHandle.handle != nullptr) {
             WCTAssert(m_concurrency.readSafety());
             WCTAssert(referencedHandle.reference > 0);
@@ -199,21 +213,14 @@ RecyclableHandle HandlePool::flowOut(HandleType type, bool writeHint)
         return nullptr;
     }
 
-    SharedLockGuard concurrencyGuard(m_concurrency);
-    std::shared_ptr<InnerHandle> handle;
-    {
-        LockGuard memoryGuard(m_memory);
-        auto &freeSlot = m_frees[slot];
-        if (!freeSlot.empty()) {
-            handle = freeSlot.back();
-            WCTAssert(handle != nullptr);
-            freeSlot.pop_back();
-        }
-    }
+    // The shared lock will be kept until the handle flows back.
+    m_concurrency.lockShared();
+    std::shared_ptr<InnerHandle> handle = m_frees[slot].pop();
 
     if (handle == nullptr) {
         handle = generateSlotedHandle(type);
         if (handle == nullptr) {
+            m_concurrency.unlockShared();
             m_counter.decreaseHandleCount(writeHint);
             return nullptr;
         }
@@ -235,6 +242,7 @@ RecyclableHandle HandlePool::flowOut(HandleType type, bool writeHint)
                 // remove if the exists handle fails in handles
                 m_handles[slot].erase(handle);
             }
+            m_concurrency.unlockShared();
             m_counter.decreaseHandleCount(writeHint);
             return nullptr;
         }
@@ -244,7 +252,6 @@ RecyclableHandle HandlePool::flowOut(HandleType type, bool writeHint)
     handle->setWriteHint(writeHint);
     handle->setActiveThreadId(Thread::getCurrentThreadId());
 
-    m_concurrency.lockShared();
     WCTAssert(referencedHandle.handle == nullptr && referencedHandle.reference == 0);
     referencedHandle.handle = handle;
     referencedHandle.reference = 1;
@@ -257,9 +264,11 @@ void HandlePool::flowBack(HandleType type, const std::shared_ptr<InnerHandle> &h
     WCTAssert(handle != nullptr);
     WCTAssert(m_concurrency.readSafety());
 
-    HandleSlot slot = slotOfHandleType(type);
+    // The referenced handle may be flowed out with another type of the same category.
+    HandleSlot slot = slotOfHandleType(handle->getType());
     WCTAssert(slot < HandleSlotCount);
     HandleCategory category = categoryOfHandleType(type);
+    WCTAssert(category == categoryOfHandleType(handle->getType()));
     WCTAssert(category < HandleCategoryCount);
 
     ReferencedHandle &referencedHandle = m_threadedHandles.getOrCreate().at(category);
@@ -273,17 +282,78 @@ void HandlePool::flowBack(HandleType type, const std::shared_ptr<InnerHandle> &h
         !handle->isPrepared(), "Statement is not finalized.", handle->finalize(););
         handle->detachCancellationSignal();
         handle->finalizeStatements();
-        {
+        handle->setWriteHint(false);
+        handle->setActiveThreadId(0);
+        if (!m_frees[slot].push(handle)) {
+            // It should rarely happen since the number of handles is limited.
             LockGuard memoryGuard(m_memory);
-            m_frees[slot].push_back(handle);
-            handle->setWriteHint(false);
-            handle->setActiveThreadId(0);
+            handle->close();
+            m_handles[slot].erase(handle);
         }
         m_concurrency.unlockShared();
         m_counter.decreaseHandleCount(writeHint);
     }
 }
 
+#pragma mark - Free Handles
+HandlePool::FreeHandles::FreeHandles() : m_count(0)
+{
+    for (auto &state : m_states) {
+        state.store(State::Empty, std::memory_order_relaxed);
+    }
+}
+
+HandlePool::FreeHandles::~FreeHandles() = default;
+
+bool HandlePool::FreeHandles::push(const std::shared_ptr<InnerHandle> &handle)
+{
+    WCTAssert(handle != nullptr);
+    for (int i = 0; i < capacity; ++i) {
+        int expected = State::Empty;
+        if (m_states[i].load(std::memory_order_relaxed) == State::Empty
+            && m_states[i].compare_exchange_strong(
+            expected, State::Busy, std::memory_order_acquire)) {
+            m_handles[i] = handle;
+            m_states[i].store(State::Full, std::memory_order_release);
+            ++m_count;
+            return true;
+        }
+    }
+    return false;
+}
+
+std::shared_ptr<InnerHandle> HandlePool::FreeHandles::pop()
+{
+    std::shared_ptr<InnerHandle> handle;
+    if (m_count.load() == 0) {
+        return handle;
+    }
+    for (int i = capacity - 1; i >= 0; --i) {
+        int expected = State::Full;
+        if (m_states[i].load(std::memory_order_relaxed) == State::Full
+            && m_states[i].compare_exchange_strong(
+            expected, State::Busy, std::memory_order_acquire)) {
+            handle = std::move(m_handles[i]);
+            m_handles[i] = nullptr;
+            m_states[i].store(State::Empty, std::memory_order_release);
+            --m_count;
+            break;
+        }
+    }
+    return handle;
+}
+
+bool HandlePool::isHoldingHandleInCurrentThread()
+{
+    // threaded handles is thread safe.
+    for (const auto &referencedHandle : m_threadedHandles.getOrCreate()) {
+        if (referencedHandle.handle != nullptr) {
+            return true;
+        }
+    }
+    return false;
+}
+
 HandlePool::ReferencedHandle::ReferencedHandle() : handle(nullptr), reference(0)
 {
 }
@@ -31,7 +31,7 @@
 #include "RecyclableHandle.hpp"
 #include "ThreadedErrors.hpp"
 #include <array>
-#include <list>
+#include <atomic>
 
 namespace WCDB {
 
@@ -43,6 +43,9 @@ namespace WCDB {
  *
  * When you are writing and reading any variables, you should lock or shared lock memory.
  * When you are operating m_handles, you should lock or shared lock concurrency in addition.
+ *
+ * The free handles are the exception. They are kept in lock-free stacks,
+ * so that flowing out a free handle and flowing it back do not need memory lock.
  */
 
 class HandlePool : public ThreadedErrorProne {
@@ -82,11 +85,13 @@ public:
     size_t numberOfAliveHandles() const;
     size_t numberOfAliveHandlesInSlot(HandleSlot slot) const;
     bool isAliving() const;
+    bool isHoldingHandleInCurrentThread();
 
 protected:
     virtual std::shared_ptr<InnerHandle> generateSlotedHandle(HandleType type) = 0;
     virtual bool willReuseSlotedHandle(HandleType type, InnerHandle *handle) = 0;
     const std::set<std::shared_ptr<InnerHandle>> &getHandlesOfSlot(HandleSlot slot);
+    void setMaxAllowedNumberOfWriters(int maxAllowedNumberOfWriters);
 
     mutable SharedLock m_memory;
 
@@ -94,7 +99,32 @@ protected:
 
 private:
     void flowBack(HandleType type, const std::shared_ptr<InnerHandle> &handle);
-    std::array<std::list<std::shared_ptr<InnerHandle>>, HandleSlotCount> m_frees;
+    void closeFreeHandles(HandleSlot slot);
+
+    class FreeHandles final {
+    public:
+        FreeHandles();
+        ~FreeHandles();
+        FreeHandles(const FreeHandles &) = delete;
+        FreeHandles &operator=(const FreeHandles &) = delete;
+
+        // return false if it's full.
+        bool push(const std::shared_ptr<InnerHandle> &handle);
+        // return nullptr if it's empty.
+        std::shared_ptr<InnerHandle> pop();
+
+    private:
+        enum State : int {
+            Empty = 0,
+            Busy,
+            Full,
+        };
+        static constexpr const int capacity = HandlePoolMaxAllowedNumberOfHandles;
+        std::array<std::atomic<int>, capacity> m_states;
+        std::array<std::shared_ptr<InnerHandle>, capacity> m_handles;
+        std::atomic<int> m_count;
+    };
+    std::array<FreeHandles, HandleSlotCount> m_frees;
     HandleCounter m_counter;
 
 #pragma mark - Threaded
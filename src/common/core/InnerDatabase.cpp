@@ -42,14 +42,17 @@
 #include "MigratingHandleDecorator.hpp"
 
 #include "AutoVacuumConfig.hpp"
+#include "PreparedStatementCacheConfig.hpp"
 #include "BusyRetryConfig.hpp"
 #include "CipherHandle.hpp"
 #include "CommonCore.hpp"
+#include "CompressionCenter.hpp"
 #include "DBOperationNotifier.hpp"
 #include "DecorativeHandle.hpp"
 #include "SQLite.h"
 
 #include <ctime>
+#include <random>
 
 namespace WCDB {
 
@@ -59,12 +62,17 @@ InnerDatabase::InnerDatabase(const UnsafeStringView &path)
 , m_initialized(false)
 , m_closing(0)
 , m_tag(Tag::invalid())
+, m_singleWriter(false)
 , m_fullSQLTrace(false)
 , m_autoCheckpoint(true)
+, m_groupCommitLeading(false)
+, m_groupCommitWindow(GroupCommitDefaultWindow)
+, m_groupCommitMaxNumberOfTransactions(GroupCommitDefaultMaxNumberOfTransactions)
 , m_factory(path)
 , m_needLoadIncremetalMaterial(false)
 , m_migration(this)
 , m_migratedCallback(nullptr)
+, m_rangeMigration(false)
 , m_compression(this)
 , m_compressedCallback(nullptr)
 , m_isInMemory(false)
@@ -248,7 +256,8 @@ void InnerDatabase::setAutoCheckpointEnable(bool enable)
 #pragma mark - Handle
 RecyclableHandle InnerDatabase::getHandle(bool writeHint)
 {
-    HandleType type = HandleType::Normal;
+    HandleType type = writeHint && m_singleWriter.load() ? HandleType::NormalWriter :
+                                                           HandleType::Normal;
     if (m_isInMemory) {
         InitializedGuard initializedGuard = initialize();
         if (m_sharedInMemoryHandle == nullptr) {
@@ -274,6 +283,12 @@ RecyclableHandle InnerDatabase::getHandle(bool writeHint)
     return handle;
 }
 
+void InnerDatabase::enableSingleWriterMode(bool enable)
+{
+    m_singleWriter.store(enable);
+    setMaxAllowedNumberOfWriters(enable ? 1 : HandlePoolMaxAllowedNumberOfWriters);
+}
+
 bool InnerDatabase::execute(const Statement &statement)
 {
     RecyclableHandle handle = getHandle(statement.isWriteStatement());
@@ -335,6 +350,7 @@ std::shared_ptr<InnerHandle> InnerDatabase::generateSlotedHandle(HandleType type
     std::shared_ptr<InnerHandle> handle;
     switch (slot) {
     case HandleSlotNormal:
+    case HandleSlotWriter:
     case HandleSlotAutoTask:
         handle = std::make_shared<DecorativeHandle>();
         break;
@@ -380,7 +396,7 @@ bool InnerDatabase::setupHandle(HandleType type, InnerHandle *handle)
     handle->markErrorAsUnignorable(99); //Clear all ignorable code
 
     // Decoration
-    if (slot == HandleSlotNormal || slot == HandleSlotAutoTask) {
+    if (slot == HandleSlotNormal || slot == HandleSlotWriter || slot == HandleSlotAutoTask) {
         bool hasDecorator = false;
         WCTAssert(dynamic_cast<DecorativeHandle *>(handle) != nullptr);
         DecorativeHandle *decorativeHandle = static_cast<DecorativeHandle *>(handle);
@@ -390,7 +406,8 @@ bool InnerDatabase::setupHandle(HandleType type, InnerHandle *handle)
             decorativeHandle->tryAddDecorator<CompressingHandleDecorator>(
             DecoratorCompressingHandle, m_compression);
         }
-        if (type == HandleType::Normal && m_migration.shouldMigrate()) {
+        if ((type == HandleType::Normal || type == HandleType::NormalWriter)
+            && m_migration.shouldMigrate()) {
             hasDecorator = true;
             decorativeHandle->tryAddDecorator<MigratingHandleDecorator>(
             DecoratorMigratingHandle, m_migration);
@@ -420,7 +437,7 @@ bool InnerDatabase::setupHandle(HandleType type, InnerHandle *handle)
             setThreadedError(handle->getError());
             return false;
         }
-        if (!hasOpened && slot == HandleSlotNormal) {
+        if (!hasOpened && (slot == HandleSlotNormal || slot == HandleSlotWriter)) {
             std::time_t openTime
             = (Time::now().nanoseconds() - start.nanoseconds()) / 1000;
             uint64_t openCPUTime = Time::currentThreadCPUTimeInMicroseconds() - cpuStart;
@@ -541,6 +558,114 @@ bool InnerDatabase::runPausableTransactionWithOneLoop(const TransactionCallbackF
     return true;
 }
 
+#pragma mark - Group Commit
+InnerDatabase::GroupCommitTask::GroupCommitTask(const TransactionCallback &transaction_)
+: transaction(transaction_), done(false), succeed(false)
+{
+}
+
+void InnerDatabase::setGroupCommitWindow(double seconds, int maxNumberOfTransactions)
+{
+    WCTAssert(seconds >= 0 && maxNumberOfTransactions > 0);
+    std::unique_lock<std::mutex> lockGuard(m_groupCommitLock);
+    m_groupCommitWindow = seconds;
+    m_groupCommitMaxNumberOfTransactions = maxNumberOfTransactions;
+}
+
+bool InnerDatabase::runTransactionInGroup(const TransactionCallback &transaction)
+{
+    if (m_isInMemory || isInTransaction()) {
+        return runTransaction(transaction);
+    }
+    GroupCommitTask task(transaction);
+    std::unique_lock<std::mutex> lockGuard(m_groupCommitLock);
+    m_groupCommitTasks.push_back(&task);
+    if (m_groupCommitTasks.size() >= (size_t) m_groupCommitMaxNumberOfTransactions) {
+        // Wake up the leader that is waiting for more transactions.
+        m_groupCommitConditional.notify_all();
+    }
+    while (!task.done) {
+        if (m_groupCommitLeading) {
+            m_groupCommitConditional.wait(lockGuard);
+            continue;
+        }
+        // Become the leader. The leader collects the pending transactions within
+        // the window and commits them for all the followers.
+        m_groupCommitLeading = true;
+        SteadyClock deadline
+        = SteadyClock::now().steadyClockByAddingTimeInterval(m_groupCommitWindow);
+        while (m_groupCommitTasks.size() < (size_t) m_groupCommitMaxNumberOfTransactions) {
+            double remaining = deadline.timeIntervalSinceNow();
+            if (remaining <= 0 || !m_groupCommitConditional.wait_for(lockGuard, remaining)) {
+                break;
+            }
+        }
+        std::list<GroupCommitTask *> tasks;
+        while (!m_groupCommitTasks.empty()
+               && tasks.size() < (size_t) m_groupCommitMaxNumberOfTransactions) {
+            tasks.push_back(m_groupCommitTasks.front());
+            m_groupCommitTasks.pop_front();
+        }
+        lockGuard.unlock();
+        runTransactionsInGroup(tasks);
+        lockGuard.lock();
+        for (auto groupedTask : tasks) {
+            groupedTask->done = true;
+        }
+        m_groupCommitLeading = false;
+        m_groupCommitConditional.notify_all();
+    }
+    lockGuard.unlock();
+    if (!task.succeed) {
+        setThreadedError(std::move(task.error));
+    }
+    return task.succeed;
+}
+
+void InnerDatabase::runTransactionsInGroup(const std::list<GroupCommitTask *> &tasks)
+{
+    RecyclableHandle handle = getHandle(true);
+    if (handle == nullptr) {
+        for (auto task : tasks) {
+            task->error = getThreadedError();
+        }
+        return;
+    }
+    bool committed = handle->runTransaction([&tasks](InnerHandle *handle) {
+        for (auto task : tasks) {
+            // Nested transaction is run in a savepoint.
+            task->succeed = handle->runTransaction(task->transaction);
+            if (!task->succeed) {
+                task->error = handle->getError();
+            }
+            if (!handle->isInTransaction()) {
+                // The whole transaction is rolled back by sqlite automatically, e.g. SQLITE_FULL, SQLITE_IOERR or SQLITE_BUSY.
+                // The previous tasks are rolled back, and the remaining ones must not run in autocommit mode.
+                Error error = task->succeed ? handle->getError() : task->error;
+                if (error.isOK()) {
+                    error = Error(Error::Code::Abort,
+                                  Error::Level::Error,
+                                  "The transaction of group is rolled back automatically.");
+                }
+                for (auto groupedTask : tasks) {
+                    groupedTask->succeed = false;
+                    groupedTask->error = error;
+                }
+                return false;
+            }
+        }
+        return true;
+    });
+    if (!committed) {
+        for (auto task : tasks) {
+            if (task->succeed) {
+                task->succeed = false;
+                task->error = handle->getError();
+            }
+        }
+    }
+}
+
 #pragma mark - File
 bool InnerDatabase::removeFiles()
 {
@@ -609,6 +734,7 @@ std::list<StringView> InnerDatabase::pathsOfDatabase(const UnsafeStringView &dat
         Repair::Factory::incrementalMaterialPathForDatabase(database),
         Repair::Factory::firstMaterialPathForDatabase(database),
         Repair::Factory::lastMaterialPathForDatabase(database),
+        Repair::Factory::materialLogPathForDatabase(database),
         Repair::Factory::factoryPathForDatabase(database),
         InnerHandle::journalPathOfDatabase(database),
         InnerHandle::shmPathOfDatabase(database),
@@ -920,7 +1046,8 @@ bool InnerDatabase::removeMaterials()
         result = FileManager::removeItems(
         { Repair::Factory::incrementalMaterialPathForDatabase(path),
           Repair::Factory::firstMaterialPathForDatabase(path),
-          Repair::Factory::lastMaterialPathForDatabase(path) });
+          Repair::Factory::lastMaterialPathForDatabase(path),
+          Repair::Factory::materialLogPathForDatabase(path) });
         if (!result) {
             assignWithSharedThreadedError();
         }
@@ -1017,6 +1144,19 @@ bool InnerDatabase::incrementalVacuum(int pages)
     return succeed;
 }
 
+#pragma mark - Prepared Statement Cache
+void InnerDatabase::setPreparedStatementCacheBudget(int maxCount, size_t maxMemory)
+{
+    if (maxCount > 0 || maxMemory > 0) {
+        setConfig(PreparedStatementCacheConfigName,
+                  std::static_pointer_cast<WCDB::Config>(
+                  std::make_shared<WCDB::PreparedStatementCacheConfig>(maxCount, maxMemory)),
+                  Configs::Priority::Low);
+    } else {
+        removeConfig(PreparedStatementCacheConfigName);
+    }
+}
+
 #pragma mark - Migration
 Optional<bool> InnerDatabase::stepMigration(bool interruptible)
 {
@@ -1040,6 +1180,7 @@ Optional<bool> InnerDatabase::stepMigration(bool interruptible)
             handle->markAsCanBeSuspended(true);
         }
         handle->markErrorAsIgnorable(Error::Code::Busy);
+        migrateOperator.setMigratesByRange(m_rangeMigration.load());
 
         done = m_migration.step(migrateOperator);
         if (!done.succeed() && handle->getError().isIgnorable()) {
@@ -1079,6 +1220,11 @@ void InnerDatabase::addMigration(const UnsafeStringView &sourcePath,
     [=]() { m_migration.addMigration(sourceDatabase, sourceCipher, filter); });
 }
 
+void InnerDatabase::enableRangeMigration(bool enable)
+{
+    m_rangeMigration.store(enable);
+}
+
 bool InnerDatabase::isMigrated() const
 {
     return m_migration.isMigrated();
@@ -1183,8 +1329,162 @@ bool InnerDatabase::rollbackCompression(const ProgressCallback &callback)
     return ret;
 }
 
+Optional<Data> InnerDatabase::trainDict(const UnsafeStringView &table,
+                                        const UnsafeStringView &column,
+                                        DictId dictId,
+                                        int maxNumberOfSamples,
+                                        size_t maxSampleSize,
+                                        size_t maxTotalSampleSize)
+{
+    WCTAssert(maxNumberOfSamples > 0 && maxSampleSize > 0 && maxTotalSampleSize > 0);
+    // Closing the database to apply the dict will wait for the handles held by current thread forever.
+    WCTRemedialAssert(!isInTransaction() && !isHoldingHandleInCurrentThread(),
+                      "Dict can't be trained in transaction or while holding a handle of the database.",
+                      return NullOpt;);
+    if (!m_compression.isCompressingColumn(table, column)) {
+        Error error(Error::Code::Misuse,
+                    Error::Level::Error,
+                    "Dict can only be trained with the content of a compressing column.");
+        error.infos.insert_or_assign(ErrorStringKeyPath, path);
+        error.infos.insert_or_assign("Table", table);
+        error.infos.insert_or_assign("Column", column);
+        Notifier::shared().notify(error);
+        setThreadedError(std::move(error));
+        return NullOpt;
+    }
+    auto samples
+    = sampleContent(table, column, maxNumberOfSamples, maxSampleSize, maxTotalSampleSize);
+    if (samples.failed()) {
+        return NullOpt;
+    }
+    size_t index = 0;
+    auto dict = CompressionCenter::shared().trainDict(
+    dictId, [&]() -> Optional<UnsafeData> {
+        if (index < samples.value().size()) {
+            return samples.value()[index++];
+        }
+        return NullOpt;
+    });
+    if (dict.failed()) {
+        assignWithSharedThreadedError();
+        return NullOpt;
+    }
+    CompressionStatistics before = testCompression(samples.value(), 0);
+    if (!CompressionCenter::shared().registerDict(dictId, dict.value())) {
+        assignWithSharedThreadedError();
+        return NullOpt;
+    }
+    CompressionStatistics after = testCompression(samples.value(), dictId);
+
+    Error error(Error::Code::Notice, Error::Level::Notice, "Dict training performance");
+    error.infos.insert_or_assign(ErrorStringKeyPath, path);
+    error.infos.insert_or_assign("Table", table);
+    error.infos.insert_or_assign("Column", column);
+    error.infos.insert_or_assign("DictId", dictId);
+    error.infos.insert_or_assign("SampleCount", samples.value().size());
+    error.infos.insert_or_assign("OriginalSize", before.originalSize);
+    error.infos.insert_or_assign("CompressedSizeBefore", before.compressedSize);
+    error.infos.insert_or_assign("CompressedSizeAfter", after.compressedSize);
+    error.infos.insert_or_assign("DecompressTimeBefore", before.decompressTime);
+    error.infos.insert_or_assign("DecompressTimeAfter", after.decompressTime);
+    Notifier::shared().notify(error);
+
+    StringView tableName(table);
+    StringView columnName(column);
+    close([=]() { m_compression.setDictForColumn(tableName, columnName, dictId); });
+    return dict;
+}
+
+Optional<std::vector<Data>> InnerDatabase::sampleContent(const UnsafeStringView &table,
+                                                         const UnsafeStringView &column,
+                                                         int maxNumberOfSamples,
+                                                         size_t maxSampleSize,
+                                                         size_t maxTotalSampleSize)
+{
+    RecyclableHandle handle = getHandle();
+    if (handle == nullptr) {
+        return NullOpt;
+    }
+    // The content is decompressed by the compressing decorator.
+    if (!handle->prepare(StatementSelect().select(Column(column)).from(table))) {
+        setThreadedError(handle->getError());
+        return NullOpt;
+    }
+    // Reservoir sampling within both the number and the size limits.
+    std::vector<Data> samples;
+    size_t totalSize = 0;
+    int capacity = maxNumberOfSamples;
+    int64_t numberOfContents = 0;
+    std::mt19937_64 random(std::random_device{}());
+    bool succeed;
+    while ((succeed = handle->step()) && !handle->done()) {
+        UnsafeData content;
+        switch (handle->getColumnType(0)) {
+        case ColumnType::Text: {
+            auto text = handle->getText();
+            content = UnsafeData((unsigned char *) text.data(), text.length());
+        } break;
+        case ColumnType::BLOB:
+            content = handle->getBLOB();
+            break;
+        default:
+            break;
+        }
+        if (content.size() == 0 || content.size() > maxSampleSize) {
+            continue;
+        }
+        ++numberOfContents;
+        if ((int) samples.size() < capacity) {
+            if (totalSize + content.size() <= maxTotalSampleSize) {
+                samples.emplace_back(content.buffer(), content.size());
+                totalSize += content.size();
+                continue;
+            }
+            // The size limit is reached. Keep the number of samples from now on.
+            capacity = (int) samples.size();
+        }
+        std::uniform_int_distribution<int64_t> distribution(0, numberOfContents - 1);
+        int64_t index = distribution(random);
+        if (index < capacity
+            && totalSize - samples[index].size() + content.size() <= maxTotalSampleSize) {
+            totalSize = totalSize - samples[index].size() + content.size();
+            samples[index] = Data(content.buffer(), content.size());
+        }
+    }
+    handle->finalize();
+    if (!succeed) {
+        setThreadedError(handle->getError());
+        return NullOpt;
+    }
+    return samples;
+}
+
+InnerDatabase::CompressionStatistics
+InnerDatabase::testCompression(const std::vector<Data> &samples, DictId dictId)
+{
+    CompressionStatistics statistics;
+    for (const auto &sample : samples) {
+        auto compressed = CompressionCenter::shared().compressContent(sample, dictId, nullptr);
+        if (compressed.failed()) {
+            continue;
+        }
+        statistics.originalSize += sample.size();
+        statistics.compressedSize += compressed.value().size();
+        if (compressed.value().size() >= sample.size()) {
+            // It's stored without compression.
+            continue;
+        }
+        // The compressed content is in a reusable buffer.
+        Data copied(compressed.value().buffer(), compressed.value().size());
+        SteadyClock start = SteadyClock::now();
+        CompressionCenter::shared().decompressContent(copied, dictId != 0, nullptr);
+        statistics.decompressTime += SteadyClock::timeIntervalSinceSteadyClockToNow(start);
+    }
+    return statistics;
+}
+
 #pragma mark - Checkpoint
-bool InnerDatabase::checkpoint(bool interruptible, CheckPointMode mode)
+bool InnerDatabase::checkpoint(bool interruptible, CheckPointMode mode, CheckPointResult *result)
 {
     InitializedGuard initializedGuard = initialize();
     if (!initializedGuard.valid()) {
@@ -1201,7 +1501,14 @@ bool InnerDatabase::checkpoint(bool interruptible, CheckPointMode mode)
         }
         tryLoadIncremetalMaterial();
         handle->markErrorAsIgnorable(Error::Code::Busy);
-        succeed = handle->checkpoint(mode);
+        bool limitBusy = interruptible && mode != CheckPointMode::Passive;
+        if (limitBusy) {
+            handle->setBusyTimeOut(AutoCheckpointBusyTimeOut);
+        }
+        succeed = handle->checkpoint(mode, result);
+        if (limitBusy) {
+            handle->setBusyTimeOut(0);
+        }
         if (!succeed && handle->getError().isIgnorable()) {
             succeed = true;
         }
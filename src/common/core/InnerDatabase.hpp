@@ -89,6 +89,7 @@ public:
     bool execute(const UnsafeStringView &sql);
     Optional<bool> tableExists(const UnsafeStringView &table);
     StringView getRunningSQLInThread(uint64_t tid) const;
+    void enableSingleWriterMode(bool enable);
 
 protected:
     std::shared_ptr<InnerHandle> generateSlotedHandle(HandleType type) override final;
@@ -96,6 +97,7 @@ protected:
 
 private:
     bool setupHandle(HandleType type, InnerHandle *handle);
+    std::atomic<bool> m_singleWriter;
 
 #pragma mark - Config
 public:
@@ -132,6 +134,30 @@ public:
     bool runTransaction(const TransactionCallback &transaction);
     bool runPausableTransactionWithOneLoop(const TransactionCallbackForOneLoop &transaction);
 
+#pragma mark - Group Commit
+public:
+    // The transactions submitted concurrently are committed together in one transaction.
+    // Each of them is run in a savepoint, so that it succeeds or fails independently.
+    bool runTransactionInGroup(const TransactionCallback &transaction);
+    void setGroupCommitWindow(double seconds, int maxNumberOfTransactions);
+
+private:
+    struct GroupCommitTask {
+        GroupCommitTask(const TransactionCallback &transaction);
+        const TransactionCallback &transaction;
+        bool done;
+        bool succeed;
+        Error error;
+    };
+    void runTransactionsInGroup(const std::list<GroupCommitTask *> &tasks);
+
+    std::mutex m_groupCommitLock;
+    Conditional m_groupCommitConditional;
+    std::list<GroupCommitTask *> m_groupCommitTasks;
+    bool m_groupCommitLeading;
+    double m_groupCommitWindow;
+    int m_groupCommitMaxNumberOfTransactions;
+
 #pragma mark - File
 public:
     const StringView &getPath() const override;
@@ -170,6 +196,10 @@ public:
     void enableAutoVacuum(bool incremental);
     bool incrementalVacuum(int pages);
 
+#pragma mark - Prepared Statement Cache
+public:
+    void setPreparedStatementCacheBudget(int maxCount, size_t maxMemory);
+
 #pragma mark - Migration
 public:
     typedef Migration::TableFilter MigrationTableFilter;
@@ -181,6 +211,7 @@ public:
     void setNotificationWhenMigrated(const MigratedCallback &callback);
 
     Optional<bool> stepMigration(bool interruptible);
+    void enableRangeMigration(bool enable);
 
     bool isMigrated() const;
 
@@ -190,6 +221,7 @@ protected:
     void didMigrate(const MigrationBaseInfo *info) override final;
     Migration m_migration; // thread-safe
     MigratedCallback m_migratedCallback;
+    std::atomic<bool> m_rangeMigration;
 
 #pragma mark - Compression
 public:
@@ -207,15 +239,42 @@ public:
 
     bool rollbackCompression(const ProgressCallback &callback);
 
+    // Train a dict with the content sampled from a compressing column and register it.
+    // Then the existing content of the column will be recompressed with the new dict.
+    // The database is closed to apply the new dict, so it can't be called in transaction or while holding a handle.
+    using DictId = Compression::DictId;
+    Optional<Data> trainDict(const UnsafeStringView &table,
+                             const UnsafeStringView &column,
+                             DictId dictId,
+                             int maxNumberOfSamples,
+                             size_t maxSampleSize,
+                             size_t maxTotalSampleSize);
+
 protected:
     void didCompress(const CompressionTableBaseInfo *info) override final;
     Compression m_compression; // thread-safe
     CompressedCallback m_compressedCallback;
 
+private:
+    struct CompressionStatistics {
+        size_t originalSize = 0;
+        size_t compressedSize = 0;
+        double decompressTime = 0;
+    };
+    Optional<std::vector<Data>> sampleContent(const UnsafeStringView &table,
+                                              const UnsafeStringView &column,
+                                              int maxNumberOfSamples,
+                                              size_t maxSampleSize,
+                                              size_t maxTotalSampleSize);
+    CompressionStatistics testCompression(const std::vector<Data> &samples, DictId dictId);
+
 #pragma mark - Checkpoint
 public:
     using CheckPointMode = AbstractHandle::CheckpointMode;
-    bool checkpoint(bool interruptible = true, CheckPointMode mode = CheckPointMode::Passive);
+    using CheckPointResult = AbstractHandle::CheckpointResult;
+    bool checkpoint(bool interruptible = true,
+                    CheckPointMode mode = CheckPointMode::Passive,
+                    CheckPointResult *result = nullptr);
 
 #pragma mark - Memory
 public:
@@ -30,14 +30,18 @@
 #include "CoreConst.h"
 #include "Notifier.hpp"
 #include "Time.hpp"
+#include <algorithm>
+#include <atomic>
 #include <stdlib.h>
 #include <string.h>
+#include <thread>
 
 namespace WCDB {
 
 CompressHandleOperator::CompressHandleOperator(InnerHandle* handle)
 : HandleOperator(handle)
 , m_compressedCount(0)
+, m_batchCount(CompressionBatchCount)
 , m_compressingTableInfo(nullptr)
 , m_insertParameterCount(0)
 , m_selectRowidStatement(handle->getStatement(DecoratorAllType))
@@ -188,7 +192,9 @@ Optional<bool> CompressHandleOperator::compressRows(const CompressionTableInfo*
     if (!prepareCompressionStatements()) {
         return NullOpt;
     }
+    int batchCount = m_batchCount;
     m_selectRowidStatement->bindInteger(m_compressingTableInfo->getMinCompressedRowid());
+    m_selectRowidStatement->bindInteger(batchCount, 2);
     auto rowids = m_selectRowidStatement->getOneColumn();
     if (rowids.failed()) {
         m_selectRowidStatement->reset();
@@ -203,7 +209,7 @@ Optional<bool> CompressHandleOperator::compressRows(const CompressionTableInfo*
     }
 
     bool compressionFinish = false;
-    if (rowids.value().size() < CompressionBatchCount) {
+    if (rowids.value().size() < batchCount) {
         m_compressingTableInfo->setMinCompressedRowid(0);
         compressionFinish = true;
     } else {
@@ -224,30 +230,61 @@ Optional<bool> CompressHandleOperator::compressRows(const CompressionTableInfo*
     return compressionFinish;
 }
 
+CompressHandleOperator::CompressingRow::CompressingRow(int64_t rowid_, OneRowValue&& row)
+: rowid(rowid_), originRow(std::move(row)), compressed(false)
+{
+}
+
 Optional<bool> CompressHandleOperator::doCompressRows(const OneColumnValue& rowids)
 {
+    // Rows are read and compressed before the write transaction,
+    // so that the CPU-bound compression does not hold the write lock.
+    std::vector<CompressingRow> rows;
+    rows.reserve(rowids.size());
+    for (const auto& rowid : rowids) {
+        m_selectRowStatement->reset();
+        m_selectRowStatement->bindInteger(rowid);
+        if (!m_selectRowStatement->step()) {
+            resetCompressionStatements();
+            return NullOpt;
+        }
+        if (m_selectRowStatement->done()) {
+            continue;
+        }
+        rows.emplace_back(rowid.intValue(), m_selectRowStatement->getOneRow());
+    }
+    m_selectRowStatement->reset();
+    m_performance.compressTime += compressRowsInParallel(rows);
+
     bool interrupted = false;
+    SteadyClock start = SteadyClock::now();
     bool ret = getHandle()->runTransaction([&](InnerHandle* handle) {
-        MultiRowsValue rows;
-        for (const auto& rowid : rowids) {
+        std::vector<const OneRowValue*> newRows;
+        newRows.reserve(rows.size());
+        for (auto& row : rows) {
             m_selectRowStatement->reset();
-            m_selectRowStatement->bindInteger(rowid);
+            m_selectRowStatement->bindInteger(row.rowid);
             if (!m_selectRowStatement->step()) {
                 return false;
             }
             if (m_selectRowStatement->done()) {
+                // Deleted after read.
                 continue;
             }
-            auto row = m_selectRowStatement->getOneRow();
-
-            if (!compressRow(row)) {
-                return false;
+            auto currentRow = m_selectRowStatement->getOneRow();
+            if (!row.compressed || currentRow != row.originRow) {
+                // Modified after read or failed to be compressed in worker.
+                // Compress it again here so that the error can be reported.
+                row.performance = CompressionPerformance();
+                if (!compressRow(currentRow, handle, row.performance)) {
+                    return false;
+                }
+                row.compressedRow = std::move(currentRow);
             }
-
-            rows.push_back(std::move(row));
+            newRows.push_back(&row.compressedRow);
 
             m_deleteRowStatement->reset();
-            m_deleteRowStatement->bindInteger(rowid);
+            m_deleteRowStatement->bindInteger(row.rowid);
             if (!m_deleteRowStatement->step()) {
                 return false;
             }
@@ -257,7 +294,8 @@ Optional<bool> CompressHandleOperator::doCompressRows(const OneColumnValue& rowi
                 return false;
             }
         }
-        for (const auto& row : rows) {
+        for (const auto& newRow : newRows) {
+            const OneRowValue& row = *newRow;
             if (handle->checkHasBusyRetry()) {
                 interrupted = true;
                 handle->notifyError(Error::Code::Notice, "", "Interrupt compression due to busy");
@@ -279,6 +317,14 @@ Optional<bool> CompressHandleOperator::doCompressRows(const OneColumnValue& rowi
         }
         return true;
     });
+    adjustBatchCount(SteadyClock::timeIntervalSinceSteadyClockToNow(start), interrupted);
+    for (const auto& row : rows) {
+        m_performance.compressedCount += row.performance.compressedCount;
+        m_performance.uncompressedCount += row.performance.uncompressedCount;
+        m_performance.compressedSize += row.performance.compressedSize;
+        m_performance.originalSize += row.performance.originalSize;
+        m_performance.totalSize += row.performance.totalSize;
+    }
     resetCompressionStatements();
     if (!ret && !interrupted) {
         return NullOpt;
@@ -286,28 +332,73 @@ Optional<bool> CompressHandleOperator::doCompressRows(const OneColumnValue& rowi
     return !interrupted;
 }
 
-bool CompressHandleOperator::compressRow(OneRowValue& row)
+int64_t CompressHandleOperator::compressRowsInParallel(std::vector<CompressingRow>& rows)
+{
+    std::atomic<size_t> next(0);
+    std::atomic<int64_t> workerCPUTime(0);
+    std::thread::id current = std::this_thread::get_id();
+    auto compress = [&]() {
+        int64_t start = Time::currentThreadCPUTimeInMicroseconds();
+        size_t index;
+        while ((index = next++) < rows.size()) {
+            CompressingRow& row = rows[index];
+            row.compressedRow = row.originRow;
+            // The errors are not reported in workers since the handle is not thread-safe.
+            // The failed rows will be compressed again in the write transaction.
+            row.compressed = compressRow(row.compressedRow, nullptr, row.performance);
+        }
+        if (std::this_thread::get_id() != current) {
+            workerCPUTime += Time::currentThreadCPUTimeInMicroseconds() - start;
+        }
+    };
+
+    int parallelism = std::min<int>(CompressionMaxNumberOfWorkers,
+                                    (int) std::thread::hardware_concurrency());
+    parallelism
+    = std::min<int>(parallelism, (int) (rows.size() / CompressionMinRowCountPerWorker));
+    // The current thread is also one of the workers.
+    CompressionCenter::shared().parallelRun(compress, parallelism);
+    return workerCPUTime.load();
+}
+
+void CompressHandleOperator::adjustBatchCount(double cost, bool interrupted)
+{
+    // Keep the write transaction short while compressing as many rows as possible in one batch.
+    if (interrupted || cost > CompressionMaxExpectingDuration) {
+        m_batchCount = std::max(m_batchCount / 2, CompressionBatchCount);
+    } else if (cost < CompressionMaxExpectingDuration / 2) {
+        m_batchCount = std::min(m_batchCount * 2, CompressionMaxBatchCount);
+    }
+}
+
+bool CompressHandleOperator::compressRow(OneRowValue& row,
+                                         InnerHandle* errorReportHandle,
+                                         CompressionPerformance& performance)
 {
     for (const auto& column : m_compressingTableInfo->getColumnInfos()) {
         if (column.getColumnIndex() >= row.size()) {
-            getHandle()->notifyError(
-            Error::Code::Error,
-            nullptr,
-            StringView::formatted("Compressing column %s with index index %u out of range",
-                                  column.getColumn().syntax().name.data(),
-                                  column.getColumnIndex()));
+            if (errorReportHandle != nullptr) {
+                errorReportHandle->notifyError(
+                Error::Code::Error,
+                nullptr,
+                StringView::formatted("Compressing column %s with index index %u out of range",
+                                      column.getColumn().syntax().name.data(),
+                                      column.getColumnIndex()));
+            }
             return false;
         }
         Value& value = row[column.getColumnIndex()];
         ColumnType valueType = value.getType();
 
         if (column.getTypeColumnIndex() >= row.size()) {
-            getHandle()->notifyError(
-            Error::Code::Error,
-            nullptr,
-            StringView::formatted("Compressing type column %s with index index %u out of range",
-                                  column.getTypeColumn().syntax().name.data(),
-                                  column.getTypeColumnIndex()));
+            if (errorReportHandle != nullptr) {
+                errorReportHandle->notifyError(
+                Error::Code::Error,
+                nullptr,
+                StringView::formatted("Compressing type column %s with index index %u out of range",
+                                      column.getTypeColumn().syntax().name.data(),
+                                      column.getTypeColumnIndex()));
+            }
             return false;
         }
 
@@ -330,7 +421,7 @@ bool CompressHandleOperator::compressRow(OneRowValue& row)
                 continue;
             }
             auto decompressed = CompressionCenter::shared().decompressContent(
-            data, originCompressionType == CompressedType::ZSTDDict, getHandle());
+            data, originCompressionType == CompressedType::ZSTDDict, errorReportHandle);
             if (!decompressed.hasValue()) {
                 return false;
             }
@@ -353,25 +444,27 @@ bool CompressHandleOperator::compressRow(OneRowValue& row)
         case CompressionType::Normal: {
             toCompressedType = CompressedType::ZSTDNormal;
             compressedValue
-            = CompressionCenter::shared().compressContent(data, 0, getHandle());
+            = CompressionCenter::shared().compressContent(data, 0, errorReportHandle);
         } break;
         case CompressionType::Dict: {
             compressedValue = CompressionCenter::shared().compressContent(
-            data, column.getDictId(), getHandle());
+            data, column.getDictId(), errorReportHandle);
         } break;
         case CompressionType::VariousDict: {
             if (column.getMatchColumnIndex() >= row.size()) {
-                getHandle()->notifyError(
-                Error::Code::Error,
-                nullptr,
-                StringView::formatted("Compressing match column %s with index index %u out of range",
-                                      column.getMatchColumn().syntax().name.data(),
-                                      column.getMatchColumnIndex()));
+                if (errorReportHandle != nullptr) {
+                    errorReportHandle->notifyError(
+                    Error::Code::Error,
+                    nullptr,
+                    StringView::formatted("Compressing match column %s with index index %u out of range",
+                                          column.getMatchColumn().syntax().name.data(),
+                                          column.getMatchColumnIndex()));
+                }
                 return false;
             }
             Value& matchValue = row[column.getMatchColumnIndex()];
             compressedValue = CompressionCenter::shared().compressContent(
-            data, column.getMatchDictId(matchValue), getHandle());
+            data, column.getMatchDictId(matchValue), errorReportHandle);
         } break;
         }
 
@@ -380,20 +473,20 @@ bool CompressHandleOperator::compressRow(OneRowValue& row)
         }
         WCTAssert(compressedValue.value().size() <= data.size());
 
-        m_performance.totalSize += data.size();
+        performance.totalSize += data.size();
         if (compressedValue.value().size() < data.size()) {
             value = compressedValue.value();
             if (!CompressionCenter::shared().testContentCanBeDecompressed(
-                value.blobValue(), toCompressedType == CompressedType::ZSTDDict, getHandle())) {
+                value.blobValue(), toCompressedType == CompressedType::ZSTDDict, errorReportHandle)) {
                 return false;
             }
             compressedType = WCDBMergeCompressionType(toCompressedType, valueType);
 
-            m_performance.compressedCount++;
-            m_performance.compressedSize += compressedValue.value().size();
-            m_performance.originalSize += data.size();
+            performance.compressedCount++;
+            performance.compressedSize += compressedValue.value().size();
+            performance.originalSize += data.size();
         } else {
-            m_performance.uncompressedCount++;
+            performance.uncompressedCount++;
             compressedType = WCDBMergeCompressionType(CompressedType::None, valueType);
         }
     }
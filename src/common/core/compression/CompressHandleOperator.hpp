@@ -28,6 +28,7 @@
 #include "HandleOperator.hpp"
 #include <array>
 #include <set>
+#include <vector>
 
 namespace WCDB {
 
@@ -55,8 +56,22 @@ private:
         size_t totalSize = 0;
     } CompressionPerformance;
 
+    struct CompressingRow {
+        CompressingRow(int64_t rowid, OneRowValue&& row);
+        int64_t rowid;
+        OneRowValue originRow;
+        OneRowValue compressedRow;
+        bool compressed;
+        CompressionPerformance performance;
+    };
+
     Optional<bool> doCompressRows(const OneColumnValue& rowids);
-    bool compressRow(OneRowValue& row);
+    // Return the CPU time used by the worker threads.
+    int64_t compressRowsInParallel(std::vector<CompressingRow>& rows);
+    bool compressRow(OneRowValue& row,
+                     InnerHandle* errorReportHandle,
+                     CompressionPerformance& performance);
+    void adjustBatchCount(double cost, bool interrupted);
 
     bool prepareCompressionStatements();
     void resetCompressionStatements();
@@ -73,6 +88,7 @@ private:
     getCompressedColumns(const CompressionTableInfo* info);
 
     int m_compressedCount;
+    int m_batchCount;
     const CompressionTableInfo* m_compressingTableInfo;
     size_t m_insertParameterCount;
     HandleStatement* m_selectRowidStatement;
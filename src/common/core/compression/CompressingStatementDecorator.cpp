@@ -763,7 +763,7 @@ bool CompressingStatementDecorator::processUpdate(const StatementUpdate& update)
     return true;
 }
 
-bool CompressingStatementDecorator::checkBindParametersExist(std::list<Syntax::Expression>& exps)
+bool CompressingStatementDecorator::checkBindParametersExist(std::vector<Syntax::Expression>& exps)
 {
     bool ret = true;
     for (auto& bindInfo : m_bindInfoList) {
@@ -792,7 +792,7 @@ bool CompressingStatementDecorator::checkBindParametersExist(std::list<Syntax::E
 }
 
 Optional<int>
-CompressingStatementDecorator::getBindParameter(std::list<Syntax::Expression>& exps,
+CompressingStatementDecorator::getBindParameter(std::vector<Syntax::Expression>& exps,
                                                 std::pair<int, int>& index)
 {
     if (exps.size() <= index.first) {
@@ -1104,7 +1104,7 @@ bool CompressingStatementDecorator::adaptCompressingColumn(Statement& statement,
     return succeed;
 }
 
-bool CompressingStatementDecorator::parseTable(const std::list<Syntax::TableOrSubquery>& tables,
+bool CompressingStatementDecorator::parseTable(const std::vector<Syntax::TableOrSubquery>& tables,
                                                StringViewMap<const CompressionTableInfo*>& tableInfos)
 {
     for (const auto& table : tables) {
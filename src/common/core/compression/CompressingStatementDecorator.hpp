@@ -84,10 +84,10 @@ protected:
                                 int *maxBindIndex = nullptr,
                                 const CompressionTableInfo *curInfo = nullptr);
     typedef StringViewMap<const CompressionTableInfo *> TableInfos;
-    bool parseTable(const std::list<Syntax::TableOrSubquery> &tables, TableInfos &tableInfos);
-    bool checkBindParametersExist(std::list<Syntax::Expression> &exps);
+    bool parseTable(const std::vector<Syntax::TableOrSubquery> &tables, TableInfos &tableInfos);
+    bool checkBindParametersExist(std::vector<Syntax::Expression> &exps);
     Optional<int>
-    getBindParameter(std::list<Syntax::Expression> &exps, std::pair<int, int> &index);
+    getBindParameter(std::vector<Syntax::Expression> &exps, std::pair<int, int> &index);
     HandleStatement &addNewHandleStatement();
 
     void resetCompressionStatus();
@@ -58,6 +58,52 @@ bool Compression::shouldCompress() const
     return m_tableFilter != nullptr;
 }
 
+bool Compression::isCompressingColumn(const UnsafeStringView& table,
+                                      const UnsafeStringView& column) const
+{
+    TableFilter filter;
+    {
+        SharedLockGuard lockGuard(m_lock);
+        filter = m_tableFilter;
+    }
+    if (filter == nullptr) {
+        return false;
+    }
+    CompressionTableUserInfo userInfo(table);
+    filter(userInfo);
+    for (const auto& columnInfo : userInfo.getColumnInfos()) {
+        if (columnInfo.getColumn().syntax().name.equal(column)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void Compression::setDictForColumn(const UnsafeStringView& table,
+                                   const UnsafeStringView& column,
+                                   DictId dictId)
+{
+    LockGuard lockGuard(m_lock);
+    m_columnDicts[table].insert_or_assign(column, dictId);
+    purge();
+}
+
+void Compression::applyDictsForColumns(CompressionTableUserInfo& userInfo,
+                                       const StringViewMap<DictId>& dicts) const
+{
+    std::list<CompressionColumnInfo> columnInfos = userInfo.getColumnInfos();
+    for (const auto& columnInfo : columnInfos) {
+        auto iter = dicts.find(columnInfo.getColumn().syntax().name);
+        if (iter == dicts.end()) {
+            continue;
+        }
+        CompressionColumnInfo newColumnInfo(columnInfo.getColumn(), CompressionType::Dict);
+        newColumnInfo.setCommonDict(iter->second);
+        userInfo.addCompressingColumn(newColumnInfo);
+        userInfo.enableReplaceCompresssion();
+    }
+}
+
 void Compression::purge()
 {
     LockGuard lockGuard(m_lock);
@@ -93,6 +139,7 @@ bool Compression::initInfo(InfoInitializer& initializer, const UnsafeStringView&
     bool hasFiltered = false;
     CompressionTableUserInfo userInfo(targetTable);
     TableFilter filter;
+    StringViewMap<DictId> columnDicts;
     {
         SharedLockGuard lockGuard(m_lock);
         filter = m_tableFilter;
@@ -101,11 +148,16 @@ bool Compression::initInfo(InfoInitializer& initializer, const UnsafeStringView&
             hasFiltered = true;
             userInfo = iter->second;
         }
+        auto dictIter = m_columnDicts.find(targetTable);
+        if (dictIter != m_columnDicts.end()) {
+            columnDicts = dictIter->second;
+        }
     }
     if (!hasFiltered) {
         if (filter != nullptr) {
             filter(userInfo);
         }
+        applyDictsForColumns(userInfo, columnDicts);
         if (!userInfo.shouldCompress()) {
             markAsNoNeedToCompress(table);
             return true;
@@ -54,10 +54,21 @@ public:
     typedef std::function<void(CompressionTableUserInfo&)> TableFilter;
     void setTableFilter(const TableFilter& tableFilter);
     bool shouldCompress() const;
+    bool isCompressingColumn(const UnsafeStringView& table, const UnsafeStringView& column) const;
+
+    // The column will be compressed with the dict instead of the configured compression,
+    // and its existing content will be recompressed.
+    using DictId = CompressionColumnInfo::DictId;
+    void setDictForColumn(const UnsafeStringView& table,
+                          const UnsafeStringView& column,
+                          DictId dictId);
 
 private:
     void purge();
+    void applyDictsForColumns(CompressionTableUserInfo& userInfo,
+                              const StringViewMap<DictId>& dicts) const;
     TableFilter m_tableFilter;
+    StringViewMap<StringViewMap<DictId>> m_columnDicts;
 
     volatile int m_dataVersion;
     ThreadLocal<int> m_localDataVersion;
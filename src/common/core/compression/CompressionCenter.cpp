@@ -24,6 +24,7 @@
 
 #include "CompressionCenter.hpp"
 #include "Assertion.hpp"
+#include "CoreConst.h"
 #include "InnerHandle.hpp"
 #include "Notifier.hpp"
 #include "ScalarFunctionModule.hpp"
@@ -38,6 +39,8 @@
 namespace WCDB {
 
 CompressionCenter::CompressionCenter()
+: m_workers(CompressionWorkerPoolName, CompressionMaxNumberOfWorkers)
+, m_decompressionCacheEnabled(false)
 {
     m_dicts = (ZSTDDict**) calloc(MaxDictId, sizeof(ZSTDDict*));
     WCTAssert(m_dicts != nullptr);
@@ -54,6 +57,11 @@ CompressionCenter& CompressionCenter::shared()
     return *g_dictCenter;
 }
 
+void CompressionCenter::parallelRun(const WorkerPool::Job& job, int parallelism)
+{
+    m_workers.parallelRun(job, parallelism);
+}
+
 ZSTDDict* CompressionCenter::getDict(DictId id) const
 {
     if (id >= MaxDictId || id == 0) {
@@ -98,6 +106,142 @@ bool CompressionCenter::registerDict(DictId dictId, const UnsafeData& data)
     return true;
 }
 
+#pragma mark - Decompression Cache
+void CompressionCenter::setDecompressionCacheBudget(size_t maxMemory)
+{
+    size_t maxMemoryPerShard = maxMemory / DecompressionCacheShardCount;
+    if (maxMemory > 0 && maxMemoryPerShard == 0) {
+        maxMemoryPerShard = 1;
+    }
+    for (auto& shard : m_decompressionCacheShards) {
+        std::lock_guard<std::mutex> lockGuard(shard.lock);
+        shard.cache.setMaxAllowedMemory(maxMemoryPerShard);
+    }
+    m_decompressionCacheEnabled = maxMemory > 0;
+}
+
+CompressionCenter::DecompressionCacheStatistics
+CompressionCenter::getDecompressionCacheStatistics() const
+{
+    DecompressionCacheStatistics statistics;
+    for (const auto& shard : m_decompressionCacheShards) {
+        std::lock_guard<std::mutex> lockGuard(shard.lock);
+        statistics.hitCount += shard.cache.m_statistics.hitCount;
+        statistics.missCount += shard.cache.m_statistics.missCount;
+        statistics.evictionCount += shard.cache.m_statistics.evictionCount;
+        statistics.usedMemory += shard.cache.m_statistics.usedMemory;
+    }
+    return statistics;
+}
+
+uint64_t CompressionCenter::getDecompressionCacheKey(const UnsafeData& compressed)
+{
+    return ((uint64_t) compressed.hash() << 32) | (uint32_t) compressed.size();
+}
+
+CompressionCenter::DecompressionCacheShard&
+CompressionCenter::getDecompressionCacheShard(uint64_t key)
+{
+    return m_decompressionCacheShards[(key >> 32) % DecompressionCacheShardCount];
+}
+
+bool CompressionCenter::tryGetDecompressedContent(const UnsafeData& compressed, Data& decompressed)
+{
+    if (!m_decompressionCacheEnabled.load()) {
+        return false;
+    }
+    uint64_t key = getDecompressionCacheKey(compressed);
+    DecompressionCacheShard& shard = getDecompressionCacheShard(key);
+    std::lock_guard<std::mutex> lockGuard(shard.lock);
+    if (shard.cache.exists(key)) {
+        const DecompressedContent& content = shard.cache.get(key);
+        // Compare the whole content in case of hash collision.
+        if (content.compressed == compressed) {
+            // It shares the buffer with the cached one.
+            decompressed = content.decompressed;
+            ++shard.cache.m_statistics.hitCount;
+            return true;
+        }
+    }
+    ++shard.cache.m_statistics.missCount;
+    return false;
+}
+
+void CompressionCenter::cacheDecompressedContent(const UnsafeData& compressed,
+                                                 const UnsafeData& decompressed)
+{
+    if (!m_decompressionCacheEnabled.load()) {
+        return;
+    }
+    uint64_t key = getDecompressionCacheKey(compressed);
+    DecompressionCacheShard& shard = getDecompressionCacheShard(key);
+    DecompressedContent content;
+    // Copy them out of the reusable buffers before locking.
+    content.compressed = Data(compressed.buffer(), compressed.size());
+    content.decompressed = Data(decompressed.buffer(), decompressed.size());
+    std::lock_guard<std::mutex> lockGuard(shard.lock);
+    if (content.compressed.size() + content.decompressed.size()
+        > shard.cache.getMaxAllowedMemory()) {
+        return;
+    }
+    shard.cache.insert(key, content);
+}
+
+CompressionCenter::DecompressionCache::DecompressionCache()
+: LRUCache<uint64_t, DecompressedContent>(), m_maxAllowedMemory(0)
+{
+}
+
+CompressionCenter::DecompressionCache::~DecompressionCache() = default;
+
+void CompressionCenter::DecompressionCache::setMaxAllowedMemory(size_t maxAllowedMemory)
+{
+    m_maxAllowedMemory = maxAllowedMemory;
+    while (shouldPurge()) {
+        purge();
+    }
+}
+
+size_t CompressionCenter::DecompressionCache::getMaxAllowedMemory() const
+{
+    return m_maxAllowedMemory;
+}
+
+void CompressionCenter::DecompressionCache::insert(uint64_t key, const DecompressedContent& content)
+{
+    remove(key);
+    m_statistics.usedMemory += content.compressed.size() + content.decompressed.size();
+    put(key, content);
+    while (shouldPurge()) {
+        purge();
+    }
+}
+
+void CompressionCenter::DecompressionCache::remove(uint64_t key)
+{
+    auto iter = m_map.find(key);
+    if (iter == m_map.end()) {
+        return;
+    }
+    const DecompressedContent& content = iter->second->second;
+    m_statistics.usedMemory -= content.compressed.size() + content.decompressed.size();
+    m_list.erase(iter->second);
+    m_map.erase(iter);
+}
+
+bool CompressionCenter::DecompressionCache::shouldPurge() const
+{
+    return !empty() && m_statistics.usedMemory > m_maxAllowedMemory;
+}
+
+void CompressionCenter::DecompressionCache::willPurge(const uint64_t& key,
+                                                     const DecompressedContent& content)
+{
+    WCDB_UNUSED(key);
+    m_statistics.usedMemory -= content.compressed.size() + content.decompressed.size();
+    ++m_statistics.evictionCount;
+}
+
 #if defined(WCDB_ZSTD) && WCDB_ZSTD
 
 Optional<Data> CompressionCenter::trainDict(DictId dictId, TrainDataEnumerator dataEnummerator)
@@ -182,34 +326,42 @@ CompressionCenter::compressContent(const UnsafeData& data, DictId dictId, InnerH
 
     int64_t boundSize = ZSTD_compressBound(data.size());
     if (ZSTD_isError(boundSize)) {
-        errorReportHandle->notifyError(
-        Error::Code::ZstdError,
-        nullptr,
-        StringView::formatted("Compress bound fail: %s", ZSTD_getErrorName(boundSize)));
+        if (errorReportHandle != nullptr) {
+            errorReportHandle->notifyError(
+            Error::Code::ZstdError,
+            nullptr,
+            StringView::formatted("Compress bound fail: %s", ZSTD_getErrorName(boundSize)));
+        }
         return NullOpt;
     }
     ZSTDContext& ctx = m_ctxes.getOrCreate();
     void* buffer = ctx.getOrCreateBuffer(boundSize);
     if (buffer == nullptr) {
-        errorReportHandle->notifyError(
-        Error::Code::NoMemory, nullptr, "Compress fail due to no memory");
+        if (errorReportHandle != nullptr) {
+            errorReportHandle->notifyError(
+            Error::Code::NoMemory, nullptr, "Compress fail due to no memory");
+        }
         return NullOpt;
     }
     int64_t compressSize = 0;
     if (dictId > 0) {
         ZSTDDict* dict = getDict(dictId);
         if (dict == nullptr) {
-            errorReportHandle->notifyError(
-            Error::Code::ZstdError,
-            nullptr,
-            StringView::formatted("Can not find compress dict with id: %d", dictId));
+            if (errorReportHandle != nullptr) {
+                errorReportHandle->notifyError(
+                Error::Code::ZstdError,
+                nullptr,
+                StringView::formatted("Can not find compress dict with id: %d", dictId));
+            }
             return NullOpt;
         }
         if (!dict->tryMemoryVerification()) {
-            errorReportHandle->notifyError(
-            Error::Code::ZstdError,
-            nullptr,
-            StringView::formatted("Dict with id %d is corrupted", dictId));
+            if (errorReportHandle != nullptr) {
+                errorReportHandle->notifyError(
+                Error::Code::ZstdError,
+                nullptr,
+                StringView::formatted("Dict with id %d is corrupted", dictId));
+            }
             return NullOpt;
         }
         compressSize = ZSTD_compress_usingCDict((ZSTD_CCtx*) ctx.getOrCreateCCtx(),
@@ -226,10 +378,12 @@ CompressionCenter::compressContent(const UnsafeData& data, DictId dictId, InnerH
                                       data.size());
     }
     if (ZSTD_isError(compressSize)) {
-        errorReportHandle->notifyError(
-        Error::Code::ZstdError,
-        nullptr,
-        StringView::formatted("Compress fail: %s", ZSTD_getErrorName(boundSize)));
+        if (errorReportHandle != nullptr) {
+            errorReportHandle->notifyError(
+            Error::Code::ZstdError,
+            nullptr,
+            StringView::formatted("Compress fail: %s", ZSTD_getErrorName(boundSize)));
+        }
         return NullOpt;
     }
     if (compressSize >= data.size()) {
@@ -250,6 +404,15 @@ void CompressionCenter::decompressContent(const UnsafeData& data,
                                                        ZSTD_getErrorName(frameSize)));
         return;
     }
+    Data cached;
+    if (tryGetDecompressedContent(data, cached)) {
+        if (originType == ColumnType::Text) {
+            resultAPI.setTextResult(UnsafeStringView((char*) cached.buffer(), cached.size()));
+        } else {
+            resultAPI.setBlobResult(cached);
+        }
+        return;
+    }
     ZSTDContext& ctx = m_ctxes.getOrCreate();
     void* buffer = ctx.getOrCreateBuffer(frameSize);
     if (buffer == nullptr) {
@@ -292,6 +455,8 @@ void CompressionCenter::decompressContent(const UnsafeData& data,
                                           ZSTD_getErrorName(decompressSize)));
         Notifier::shared().notify(error);
         decompressSize = 0;
+    } else {
+        cacheDecompressedContent(data, UnsafeData((unsigned char*) buffer, decompressSize));
     }
     if (originType == ColumnType::Text) {
         resultAPI.setTextResult(UnsafeStringView((char*) buffer, decompressSize));
@@ -305,31 +470,39 @@ CompressionCenter::decompressContent(const UnsafeData& data, bool usingDict, Inn
 {
     int64_t frameSize = ZSTD_getFrameContentSize(data.buffer(), data.size());
     if (ZSTD_isError(frameSize)) {
-        handle->notifyError(Error::Code::ZstdError,
-                            nullptr,
-                            StringView::formatted("Get compress content frame size fail: %s",
-                                                  ZSTD_getErrorName(frameSize)));
+        if (handle != nullptr) {
+            handle->notifyError(Error::Code::ZstdError,
+                                nullptr,
+                                StringView::formatted("Get compress content frame size fail: %s",
+                                                      ZSTD_getErrorName(frameSize)));
+        }
         return NullOpt;
     }
     ZSTDContext& ctx = m_ctxes.getOrCreate();
     void* buffer = ctx.getOrCreateBuffer(frameSize);
     if (buffer == nullptr) {
-        handle->notifyError(Error::Code::NoMemory, nullptr, "Decompress fail due to no memory");
+        if (handle != nullptr) {
+            handle->notifyError(Error::Code::NoMemory, nullptr, "Decompress fail due to no memory");
+        }
         return NullOpt;
     }
     int64_t decompressSize = 0;
     if (usingDict) {
         DictId dictId = ZSTD_getDictID_fromFrame(data.buffer(), data.size());
         if (dictId == 0) {
-            handle->notifyError(Error::Code::ZstdError, nullptr, "Can not decode dictid");
+            if (handle != nullptr) {
+                handle->notifyError(Error::Code::ZstdError, nullptr, "Can not decode dictid");
+            }
             return NullOpt;
         }
         ZSTDDict* dict = getDict(dictId);
         if (dict == nullptr) {
-            handle->notifyError(
-            Error::Code::ZstdError,
-            nullptr,
-            StringView::formatted("Can not find decompress dict with id: %d", dictId));
+            if (handle != nullptr) {
+                handle->notifyError(
+                Error::Code::ZstdError,
+                nullptr,
+                StringView::formatted("Can not find decompress dict with id: %d", dictId));
+            }
             return NullOpt;
         }
         decompressSize = ZSTD_decompress_usingDDict((ZSTD_DCtx*) ctx.getOrCreateDCtx(),
@@ -364,32 +537,40 @@ bool CompressionCenter::testContentCanBeDecompressed(const UnsafeData& data,
 {
     int64_t frameSize = ZSTD_getFrameContentSize(data.buffer(), data.size());
     if (ZSTD_isError(frameSize)) {
-        errorReportHandle->notifyError(
-        Error::Code::ZstdError,
-        StringView::formatted("Get compress content frame size fail: %s",
-                              ZSTD_getErrorName(frameSize)));
+        if (errorReportHandle != nullptr) {
+            errorReportHandle->notifyError(
+            Error::Code::ZstdError,
+            StringView::formatted("Get compress content frame size fail: %s",
+                                  ZSTD_getErrorName(frameSize)));
+        }
         return false;
     }
     ZSTDContext& ctx = m_ctxes.getOrCreate();
     void* buffer = ctx.getOrCreateBuffer(frameSize);
     if (buffer == nullptr) {
-        errorReportHandle->notifyError(
-        Error::Code::NoMemory, "", "Decompress fail due to no memory");
+        if (errorReportHandle != nullptr) {
+            errorReportHandle->notifyError(
+            Error::Code::NoMemory, "", "Decompress fail due to no memory");
+        }
         return false;
     }
     int64_t decompressSize = 0;
     if (usingDict) {
         DictId dictId = ZSTD_getDictID_fromFrame(data.buffer(), data.size());
         if (dictId == 0) {
-            errorReportHandle->notifyError(Error::Code::ZstdError, "", "Can not decode dictid");
+            if (errorReportHandle != nullptr) {
+                errorReportHandle->notifyError(Error::Code::ZstdError, "", "Can not decode dictid");
+            }
             return false;
         }
         ZSTDDict* dict = getDict(dictId);
         if (dict == nullptr) {
-            errorReportHandle->notifyError(
-            Error::Code::ZstdError,
-            "",
-            StringView::formatted("Can not find decompress dict with id: %d", dictId));
+            if (errorReportHandle != nullptr) {
+                errorReportHandle->notifyError(
+                Error::Code::ZstdError,
+                "",
+                StringView::formatted("Can not find decompress dict with id: %d", dictId));
+            }
             return false;
         }
         decompressSize = ZSTD_decompress_usingDDict((ZSTD_DCtx*) ctx.getOrCreateDCtx(),
@@ -407,10 +588,12 @@ bool CompressionCenter::testContentCanBeDecompressed(const UnsafeData& data,
     }
 
     if (ZSTD_isError(decompressSize)) {
-        errorReportHandle->notifyError(
-        Error::Code::ZstdError,
-        "",
-        StringView::formatted("Decompress fail: %s", ZSTD_getErrorName(decompressSize)));
+        if (errorReportHandle != nullptr) {
+            errorReportHandle->notifyError(
+            Error::Code::ZstdError,
+            "",
+            StringView::formatted("Decompress fail: %s", ZSTD_getErrorName(decompressSize)));
+        }
         return false;
     }
     return true;
@@ -429,16 +612,20 @@ Optional<Data> CompressionCenter::trainDict(DictId, TrainDataEnumerator)
 Optional<UnsafeData>
 CompressionCenter::compressContent(const UnsafeData&, DictId, InnerHandle* errorReportHandle)
 {
-    errorReportHandle->notifyError(
-    Error::Code::ZstdError, nullptr, "You need to build WCDB with WCDB_ZSTD macro");
+    if (errorReportHandle != nullptr) {
+        errorReportHandle->notifyError(
+        Error::Code::ZstdError, nullptr, "You need to build WCDB with WCDB_ZSTD macro");
+    }
     return NullOpt;
 }
 
 Optional<UnsafeData>
 CompressionCenter::decompressContent(const UnsafeData& data, bool usingDict, InnerHandle* handle)
 {
-    handle->notifyError(
-    Error::Code::ZstdError, nullptr, "You need to build WCDB with WCDB_ZSTD macro");
+    if (handle != nullptr) {
+        handle->notifyError(
+        Error::Code::ZstdError, nullptr, "You need to build WCDB with WCDB_ZSTD macro");
+    }
     return NullOpt;
 }
 
@@ -450,8 +637,10 @@ void CompressionCenter::decompressContent(const UnsafeData&, bool, ColumnType, S
 
 bool CompressionCenter::testContentCanBeDecompressed(const UnsafeData&, bool, InnerHandle* errorReportHandle)
 {
-    errorReportHandle->notifyError(
-    Error::Code::ZstdError, "", "You need to build WCDB with WCDB_ZSTD macro");
+    if (errorReportHandle != nullptr) {
+        errorReportHandle->notifyError(
+        Error::Code::ZstdError, "", "You need to build WCDB with WCDB_ZSTD macro");
+    }
     return false;
 }
 
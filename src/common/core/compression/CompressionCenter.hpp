@@ -26,7 +26,10 @@
 
 #include "ColumnType.hpp"
 #include "CompressionConst.hpp"
+#include "LRUCache.hpp"
+#include "Lock.hpp"
 #include "ThreadLocal.hpp"
+#include "WorkerPool.hpp"
 #include "ZSTDContext.hpp"
 #include "ZSTDDict.hpp"
 #include <memory>
@@ -52,6 +55,7 @@ public:
     typedef std::function<Optional<UnsafeData>()> TrainDataEnumerator;
     Optional<Data> trainDict(DictId dictId, TrainDataEnumerator dataEnummerator);
 
+    // The error will not be reported if errorReportHandle is null.
     Optional<UnsafeData>
     compressContent(const UnsafeData& data, DictId dictId, InnerHandle* errorReportHandle);
     void decompressContent(const UnsafeData& data,
@@ -69,6 +73,68 @@ private:
     ZSTDDict* getDict(DictId id) const;
     ZSTDDict** m_dicts;
     ThreadLocal<ZSTDContext> m_ctxes;
+
+#pragma mark - Parallel Compression
+public:
+    // The job is run by the current thread and the workers shared by all databases.
+    // Workers are kept alive, so that their ZSTD contexts are reused among batches.
+    void parallelRun(const WorkerPool::Job& job, int parallelism);
+
+private:
+    WorkerPool m_workers;
+
+#pragma mark - Decompression Cache
+public:
+    // The decompressed results of the same compressed content are reused.
+    // 0 means the cache is disabled, which is the default.
+    void setDecompressionCacheBudget(size_t maxMemory);
+
+    struct DecompressionCacheStatistics {
+        uint64_t hitCount = 0;
+        uint64_t missCount = 0;
+        uint64_t evictionCount = 0;
+        size_t usedMemory = 0;
+    };
+    DecompressionCacheStatistics getDecompressionCacheStatistics() const;
+
+private:
+    bool tryGetDecompressedContent(const UnsafeData& compressed, Data& decompressed);
+    void cacheDecompressedContent(const UnsafeData& compressed, const UnsafeData& decompressed);
+
+    struct DecompressedContent {
+        Data compressed;
+        Data decompressed;
+    };
+    // The key is made up of the hash and the size of compressed content.
+    class DecompressionCache final : public LRUCache<uint64_t, DecompressedContent> {
+    public:
+        DecompressionCache();
+        ~DecompressionCache() override;
+
+        void setMaxAllowedMemory(size_t maxAllowedMemory);
+        size_t getMaxAllowedMemory() const;
+        void insert(uint64_t key, const DecompressedContent& content);
+        void remove(uint64_t key);
+
+        DecompressionCacheStatistics m_statistics;
+
+    protected:
+        bool shouldPurge() const override final;
+        void willPurge(const uint64_t& key, const DecompressedContent& content) override final;
+        size_t m_maxAllowedMemory;
+    };
+    // The cache is sharded by key, so that the decompressions of different contents rarely wait for each other.
+    // Each shard takes an equal part of the budget.
+    static constexpr const int DecompressionCacheShardCount = 16;
+    struct DecompressionCacheShard {
+        mutable std::mutex lock;
+        DecompressionCache cache;
+    };
+    static uint64_t getDecompressionCacheKey(const UnsafeData& compressed);
+    DecompressionCacheShard& getDecompressionCacheShard(uint64_t key);
+
+    std::atomic<bool> m_decompressionCacheEnabled;
+    DecompressionCacheShard m_decompressionCacheShards[DecompressionCacheShardCount];
 };
 
 } // namespace WCDB
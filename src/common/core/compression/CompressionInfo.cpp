@@ -346,7 +346,7 @@ StatementSelect CompressionTableInfo::getSelectNeedCompressRowIdStatement() cons
     .from(m_table)
     .where(condition)
     .order(Column::rowid().asOrder(Order::DESC))
-    .limit(CompressionBatchCount);
+    .limit(BindParameter());
 }
 
 StatementSelect CompressionTableInfo::getSelectRowStatement() const
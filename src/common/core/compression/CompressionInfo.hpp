@@ -142,7 +142,7 @@ public:
      WHERE rowid < ?
      (WCDB_CT_compressingColumnA IS NULL OR WCDB_CT_compressingColumnB IS NULL ...)
      ORDER BY rowid DESC
-     LIMIT 10
+     LIMIT ?
      */
     StatementSelect getSelectNeedCompressRowIdStatement() const;
 
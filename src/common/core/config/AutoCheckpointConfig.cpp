@@ -24,10 +24,13 @@
 
 #include "AutoCheckpointConfig.hpp"
 #include "Assertion.hpp"
+#include "CoreConst.h"
 #include "Global.hpp"
 #include "InnerHandle.hpp"
 #include "StatementPragma.hpp"
 #include "StringView.hpp"
+#include <algorithm>
+#include <cmath>
 #include <regex>
 
 namespace WCDB {
@@ -80,34 +83,154 @@ void AutoCheckpointConfig::setMinFrames(int frame)
 bool AutoCheckpointConfig::onCommitted(const UnsafeStringView& path, int frames)
 {
     bool needCheckpoint = frames > 0;
-    if (m_minFrames > 0) {
-        int* curFrames = nullptr;
-        {
-            SharedLockGuard guard(m_lock);
-            auto iter = m_frames.find(path);
-            if (iter != m_frames.end()) {
-                curFrames = &(iter->second);
+    double delay = OperationQueueTimeIntervalForCheckpoint;
+    {
+        LockGuard guard(m_lock);
+        State& state = m_states[path];
+
+        // The wal file is restarted after it's checkpointed, so that the frames may be fewer than last time.
+        int newFrames = frames >= state.walFrames ? frames - state.walFrames : frames;
+        // Frames written in the recent window, decayed exponentially with time.
+        SteadyClock now = SteadyClock::now();
+        double interval = now.timeIntervalSinceSteadyClock(state.lastCommitTime);
+        state.statistics.frameRate
+        = state.statistics.frameRate * exp(-std::max(interval, 0.0) / AutoCheckpointFrameRateWindow)
+          + newFrames / AutoCheckpointFrameRateWindow;
+        state.lastCommitTime = now;
+        state.walFrames = frames;
+        state.statistics.maxWALFrames = std::max(state.statistics.maxWALFrames, frames);
+
+        if (m_minFrames > 0) {
+            if (frames + state.accumulatedFrames > m_minFrames) {
+                needCheckpoint = true;
+                state.accumulatedFrames = 0;
+            } else {
+                needCheckpoint = false;
+                state.accumulatedFrames += frames;
             }
         }
-        if (curFrames == nullptr) {
-            LockGuard guard(m_lock);
-            m_frames.insert_or_assign(path, 0);
-            curFrames = &(m_frames.at(path));
-        }
-        if (frames + *curFrames > m_minFrames) {
-            needCheckpoint = true;
-            *curFrames = 0;
-        } else {
-            needCheckpoint = false;
-            *curFrames = *curFrames + frames;
+        // A large wal slows down the reading, so it's always checkpointed in time.
+        needCheckpoint = needCheckpoint || frames >= AutoCheckpointFramesForFull;
+        if (needCheckpoint) {
+            delay = delayForCheckpoint(state);
+            if (delay < OperationQueueTimeIntervalForCheckpoint) {
+                ++state.statistics.urgentCount;
+            }
+            state.statistics.lastDelay = delay;
         }
     }
     if (needCheckpoint) {
-        m_operator->asyncCheckpoint(path);
+        m_operator->asyncCheckpoint(path, delay);
     }
     return true;
 }
 
+double AutoCheckpointConfig::delayForCheckpoint(const State& state) const
+{
+    if (state.walFrames >= AutoCheckpointFramesForFull
+        || state.statistics.frameRate >= AutoCheckpointFrameRateForBurst) {
+        return OperationQueueTimeIntervalForUrgentCheckpoint;
+    }
+    if (state.walFrames <= AutoCheckpointMaxFramesForIdle
+        && state.statistics.frameRate * OperationQueueTimeIntervalForCheckpoint
+           <= AutoCheckpointMaxFramesForIdle) {
+        // The wal won't grow much before next checkpoint.
+        return OperationQueueTimeIntervalForIdleCheckpoint;
+    }
+    return OperationQueueTimeIntervalForCheckpoint;
+}
+
+AutoCheckpointConfig::CheckpointMode AutoCheckpointConfig::checkpointModeOfState(const State& state)
+{
+    static_assert((int) CheckpointMode::Passive == 0 && (int) CheckpointMode::Full == 1
+                  && (int) CheckpointMode::Restart == 2
+                  && (int) CheckpointMode::Truncate == 3,
+                  "");
+    int level = (int) CheckpointMode::Passive;
+    if (state.walFrames >= AutoCheckpointFramesForTruncate) {
+        level = (int) CheckpointMode::Truncate;
+    } else if (state.walFrames >= AutoCheckpointFramesForFull) {
+        level = (int) CheckpointMode::Full;
+    }
+    level += state.consecutiveBlockedTimes / AutoCheckpointBlockedTimesToEscalate;
+    return (CheckpointMode) std::min(level, (int) CheckpointMode::Truncate);
+}
+
+AutoCheckpointConfig::CheckpointMode
+AutoCheckpointConfig::getCheckpointMode(const UnsafeStringView& path) const
+{
+    SharedLockGuard guard(m_lock);
+    auto iter = m_states.find(path);
+    if (iter == m_states.end()) {
+        return CheckpointMode::Passive;
+    }
+    return checkpointModeOfState(iter->second);
+}
+
+void AutoCheckpointConfig::checkpointDidFinish(const UnsafeStringView& path,
+                                               CheckpointMode mode,
+                                               bool succeed,
+                                               const CheckpointResult& result)
+{
+    if (!succeed) {
+        // Interrupted or failed. It will be checkpointed again with the next commit.
+        return;
+    }
+    bool retry = false;
+    {
+        LockGuard guard(m_lock);
+        State& state = m_states[path];
+        switch (mode) {
+        case CheckpointMode::Passive:
+            ++state.statistics.passiveCount;
+            break;
+        case CheckpointMode::Full:
+            ++state.statistics.fullCount;
+            break;
+        case CheckpointMode::Restart:
+            ++state.statistics.restartCount;
+            break;
+        case CheckpointMode::Truncate:
+            ++state.statistics.truncateCount;
+            break;
+        }
+        // Busy is ignored by checkpoint, so that the blocked frames are checked instead.
+        if (result.numberOfFrames < 0
+            || result.numberOfCheckpointedFrames < result.numberOfFrames) {
+            ++state.statistics.blockedCount;
+            // Retry until it's escalated to the strongest mode, without waiting for the next commit.
+            retry = mode != CheckpointMode::Truncate;
+            if (retry) {
+                ++state.consecutiveBlockedTimes;
+                state.statistics.lastDelay = OperationQueueTimeIntervalForCheckpoint;
+            } else {
+                // The strongest mode is tried. Long-lived readers may still block it,
+                // so the next checkpoint starts from the mode of wal size again instead of stalling the writes each time.
+                state.consecutiveBlockedTimes = 0;
+            }
+        } else {
+            state.consecutiveBlockedTimes = 0;
+            state.walFrames = 0;
+            state.accumulatedFrames = 0;
+        }
+    }
+    if (retry) {
+        m_operator->asyncCheckpoint(path, OperationQueueTimeIntervalForCheckpoint);
+    }
+}
+
+AutoCheckpointConfig::Statistics AutoCheckpointConfig::getStatistics(const UnsafeStringView& path) const
+{
+    Statistics statistics;
+    SharedLockGuard guard(m_lock);
+    auto iter = m_states.find(path);
+    if (iter != m_states.end()) {
+        statistics = iter->second.statistics;
+        statistics.walFrames = iter->second.walFrames;
+    }
+    return statistics;
+}
+
 void AutoCheckpointConfig::log(int rc, const char* message)
 {
     Error::ExtCode extCode = Error::rc2ec(rc);
@@ -123,7 +246,15 @@ void AutoCheckpointConfig::log(int rc, const char* message)
             // hint checkpoint
             if (frames > 0) {
                 StringView path(match[2].str());
-                m_operator->asyncCheckpoint(path);
+                double delay = OperationQueueTimeIntervalForCheckpoint;
+                {
+                    LockGuard guard(m_lock);
+                    State& state = m_states[path];
+                    state.walFrames = frames;
+                    delay = delayForCheckpoint(state);
+                    state.statistics.lastDelay = delay;
+                }
+                m_operator->asyncCheckpoint(path, delay);
             }
         }
     }
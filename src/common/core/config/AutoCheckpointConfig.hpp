@@ -24,9 +24,11 @@
 
 #pragma once
 
+#include "AbstractHandle.hpp"
 #include "Config.hpp"
 #include "Lock.hpp"
 #include "Statement.hpp"
+#include "Time.hpp"
 
 namespace WCDB {
 
@@ -34,7 +36,7 @@ class AutoCheckpointOperator {
 public:
     virtual ~AutoCheckpointOperator() = 0;
 
-    virtual void asyncCheckpoint(const UnsafeStringView &path) = 0;
+    virtual void asyncCheckpoint(const UnsafeStringView &path, double delay) = 0;
 };
 
 class AutoCheckpointConfig final : public Config {
@@ -46,15 +48,52 @@ public:
     bool uninvoke(InnerHandle *handle) override final;
     void setMinFrames(int frame);
 
+    typedef AbstractHandle::CheckpointMode CheckpointMode;
+    typedef AbstractHandle::CheckpointResult CheckpointResult;
+
+    // The mode is escalated with the size of wal and the checkpoints blocked by readers.
+    CheckpointMode getCheckpointMode(const UnsafeStringView &path) const;
+    void checkpointDidFinish(const UnsafeStringView &path,
+                             CheckpointMode mode,
+                             bool succeed,
+                             const CheckpointResult &result);
+
+    typedef struct Statistics {
+        uint64_t passiveCount = 0;
+        uint64_t fullCount = 0;
+        uint64_t restartCount = 0;
+        uint64_t truncateCount = 0;
+        // Checkpoints that failed to write all the frames back because of readers.
+        uint64_t blockedCount = 0;
+        // Checkpoints scheduled with a shortened delay because of the wal size or write rate.
+        uint64_t urgentCount = 0;
+        int walFrames = 0;
+        int maxWALFrames = 0;
+        double frameRate = 0; // frames per second
+        double lastDelay = 0;
+    } Statistics;
+    Statistics getStatistics(const UnsafeStringView &path) const;
+
 protected:
     const StringView m_identifier;
-    bool onCommitted(const UnsafeStringView &path, int pages);
+    bool onCommitted(const UnsafeStringView &path, int frames);
     void log(int rc, const char *message);
 
+    struct State {
+        // Number of frames in wal file, reported by the last commit.
+        int walFrames = 0;
+        int accumulatedFrames = 0;
+        int consecutiveBlockedTimes = 0;
+        SteadyClock lastCommitTime;
+        Statistics statistics;
+    };
+    double delayForCheckpoint(const State &state) const;
+    static CheckpointMode checkpointModeOfState(const State &state);
+
     int m_minFrames;
     std::shared_ptr<AutoCheckpointOperator> m_operator;
     Statement m_disableAutoCheckpoint;
-    StringViewMap<int> m_frames;
+    StringViewMap<State> m_states;
     mutable SharedLock m_lock;
 };
 
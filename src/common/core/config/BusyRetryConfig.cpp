@@ -27,6 +27,7 @@
 #include "CoreConst.h"
 #include "InnerHandle.hpp"
 #include "Time.hpp"
+#include <algorithm>
 
 namespace WCDB {
 
@@ -58,8 +59,11 @@ BusyRetryConfig::~BusyRetryConfig()
 
 bool BusyRetryConfig::invoke(InnerHandle* handle)
 {
-    handle->setNotificationWhenBusy(std::bind(
-    &BusyRetryConfig::onBusy, this, std::placeholders::_1, std::placeholders::_2));
+    handle->setNotificationWhenBusy(std::bind(&BusyRetryConfig::onBusy,
+                                              this,
+                                              std::placeholders::_1,
+                                              std::placeholders::_2,
+                                              std::placeholders::_3));
     return true;
 }
 
@@ -79,14 +83,14 @@ bool BusyRetryConfig::checkHasBusyRetry(const UnsafeStringView& path)
     return getOrCreateState(path).checkHasBusyRetry();
 }
 
-bool BusyRetryConfig::onBusy(const UnsafeStringView& path, int numberOfTimes)
+bool BusyRetryConfig::onBusy(const UnsafeStringView& path, int numberOfTimes, double timeOut)
 {
     WCDB_UNUSED(path);
     WCDB_UNUSED(numberOfTimes);
 
     Trying& trying = m_tryings.getOrCreate();
     WCTAssert(trying.valid());
-    return getOrCreateState(trying.getPath()).wait(trying);
+    return getOrCreateState(trying.getPath()).wait(trying, timeOut);
 }
 
 #pragma mark - Busy Moniter
@@ -275,14 +279,25 @@ bool BusyRetryConfig::State::localShouldWait(const Expecting& expecting) const
     return wait;
 }
 
-bool BusyRetryConfig::State::wait(Trying& trying)
+bool BusyRetryConfig::State::wait(Trying& trying, double maxTimeOut)
 {
     static_assert(Exclusivity::Must < Exclusivity::NoMatter, "");
 
     double timeOut = m_busyMonitor != nullptr && m_timeOut > 0 ? m_timeOut : BusyRetryTimeOut;
     int timeOutTimes = 0;
+    SteadyClock deadline;
+    if (maxTimeOut > 0) {
+        deadline = SteadyClock::now().steadyClockByAddingTimeInterval(maxTimeOut);
+    }
     std::unique_lock<std::mutex> lockGuard(m_lock);
     while (shouldWait(trying)) {
+        if (maxTimeOut > 0) {
+            double remaining = deadline.timeIntervalSinceNow();
+            if (remaining <= 0) {
+                return false;
+            }
+            timeOut = std::min(timeOut, remaining);
+        }
         Thread currentThread = Thread::current();
         // main thread first
         Exclusivity exclusivity
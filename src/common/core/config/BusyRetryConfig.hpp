@@ -44,7 +44,7 @@ public:
     bool checkHasBusyRetry(const UnsafeStringView& path);
 
 protected:
-    bool onBusy(const UnsafeStringView& path, int numberOfTimes);
+    bool onBusy(const UnsafeStringView& path, int numberOfTimes, double timeOut);
 
     const StringView m_identifier;
 
@@ -100,7 +100,8 @@ protected:
         void updatePagerLock(PagerLockType type);
         void updateShmLock(void* identifier, int sharedMask, int exclusiveMask);
 
-        bool wait(Trying& trying);
+        // Return false if it's timeout while the time of waiting is limited by maxTimeOut.
+        bool wait(Trying& trying, double maxTimeOut);
         StringView m_path;
         bool checkMainThreadBusyRetry();
         bool checkHasBusyRetry();
@@ -0,0 +1,48 @@
+//
+// Created by qiuwenchen on 2026/10/16.
+//
+
+/*
+ * Tencent is pleased to support the open source community by making
+ * WCDB available.
+ *
+ * Copyright (C) 2017 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the BSD 3-Clause License (the "License"); you may not use
+ * this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *       https://opensource.org/licenses/BSD-3-Clause
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PreparedStatementCacheConfig.hpp"
+
+namespace WCDB {
+
+PreparedStatementCacheConfig::PreparedStatementCacheConfig(int maxCount, size_t maxMemory)
+: m_maxCount(maxCount), m_maxMemory(maxMemory)
+{
+}
+
+PreparedStatementCacheConfig::~PreparedStatementCacheConfig() = default;
+
+bool PreparedStatementCacheConfig::invoke(InnerHandle* handle)
+{
+    handle->setPreparedStatementCacheBudget(m_maxCount, m_maxMemory);
+    return true;
+}
+
+bool PreparedStatementCacheConfig::uninvoke(InnerHandle* handle)
+{
+    handle->setPreparedStatementCacheBudget(0, 0);
+    return true;
+}
+
+} // namespace WCDB
@@ -26,7 +26,9 @@
 #include "Assertion.hpp"
 #include "CoreConst.h"
 #include "Time.hpp"
+#include <algorithm>
 #include <cmath>
+#include <limits>
 
 namespace WCDB {
 
@@ -35,6 +37,9 @@ MigrateHandleOperator::MigrateHandleOperator(InnerHandle* handle)
 , m_migratingInfo(nullptr)
 , m_migrateStatement(handle->getStatement(DecoratorMigratingHandleStatement))
 , m_removeMigratedStatement(handle->getStatement(DecoratorMigratingHandleStatement))
+, m_migratesByRange(false)
+, m_batchCount(MigrateBatchCount)
+, m_selectLowerBoundStatement(handle->getStatement(DecoratorMigratingHandleStatement))
 , m_samplePointing(0)
 {
 }
@@ -44,6 +49,7 @@ MigrateHandleOperator::~MigrateHandleOperator()
     finalizeMigrationStatement();
     getHandle()->returnStatement(m_migrateStatement);
     getHandle()->returnStatement(m_removeMigratedStatement);
+    getHandle()->returnStatement(m_selectLowerBoundStatement);
 }
 
 void MigrateHandleOperator::onDecorationChange()
@@ -57,6 +63,9 @@ void MigrateHandleOperator::onDecorationChange()
 
     handle->returnStatement(m_removeMigratedStatement);
     m_removeMigratedStatement = handle->getStatement(DecoratorMigratingHandleStatement);
+
+    handle->returnStatement(m_selectLowerBoundStatement);
+    m_selectLowerBoundStatement = handle->getStatement(DecoratorMigratingHandleStatement);
 }
 
 bool MigrateHandleOperator::reAttach(const MigrationBaseInfo* info)
@@ -166,14 +175,7 @@ Optional<bool> MigrateHandleOperator::migrateRows(const MigrationInfo* info)
         m_migratingInfo = info;
     }
 
-    if (!m_migrateStatement->isPrepared()
-        && !m_migrateStatement->prepare(m_migratingInfo->getStatementForMigratingOneRow())) {
-        return NullOpt;
-    }
-
-    if (!m_removeMigratedStatement->isPrepared()
-        && !m_removeMigratedStatement->prepare(
-        m_migratingInfo->getStatementForDeletingMigratedOneRow())) {
+    if (!prepareMigrationStatement()) {
         return NullOpt;
     }
 
@@ -184,7 +186,14 @@ Optional<bool> MigrateHandleOperator::migrateRows(const MigrationInfo* info)
         [&migrated, &beforeTransaction, &timeIntervalWithinTransaction, this](InnerHandle*) -> bool {
             double cost = 0;
             do {
-                migrated = migrateRow();
+                if (m_migratesByRange) {
+                    SteadyClock beforeRange = SteadyClock::now();
+                    migrated = migrateRange();
+                    adjustBatchCount(SteadyClock::timeIntervalSinceSteadyClockToNow(beforeRange),
+                                     timeIntervalWithinTransaction);
+                } else {
+                    migrated = migrateRow();
+                }
                 cost = SteadyClock::timeIntervalSinceSteadyClockToNow(beforeTransaction);
             } while (migrated.succeed() && !migrated.value()
                      && cost < timeIntervalWithinTransaction);
@@ -221,10 +230,88 @@ Optional<bool> MigrateHandleOperator::migrateRow()
     return migrated;
 }
 
+bool MigrateHandleOperator::prepareMigrationStatement()
+{
+    if (m_migratesByRange) {
+        if (!m_selectLowerBoundStatement->isPrepared()
+            && !m_selectLowerBoundStatement->prepare(
+            m_migratingInfo->getStatementForSelectingLowerBoundOfRange())) {
+            return false;
+        }
+        if (!m_migrateStatement->isPrepared()
+            && !m_migrateStatement->prepare(m_migratingInfo->getStatementForMigratingRange())) {
+            return false;
+        }
+        if (!m_removeMigratedStatement->isPrepared()
+            && !m_removeMigratedStatement->prepare(
+            m_migratingInfo->getStatementForDeletingMigratedRange())) {
+            return false;
+        }
+    } else {
+        if (!m_migrateStatement->isPrepared()
+            && !m_migrateStatement->prepare(m_migratingInfo->getStatementForMigratingOneRow())) {
+            return false;
+        }
+        if (!m_removeMigratedStatement->isPrepared()
+            && !m_removeMigratedStatement->prepare(
+            m_migratingInfo->getStatementForDeletingMigratedOneRow())) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void MigrateHandleOperator::finalizeMigrationStatement()
 {
     m_migrateStatement->finalize();
     m_removeMigratedStatement->finalize();
+    m_selectLowerBoundStatement->finalize();
+}
+
+#pragma mark - Range
+void MigrateHandleOperator::setMigratesByRange(bool enable)
+{
+    if (m_migratesByRange != enable) {
+        // The prepared statements are different between two modes.
+        finalizeMigrationStatement();
+        m_migratesByRange = enable;
+    }
+}
+
+Optional<bool> MigrateHandleOperator::migrateRange()
+{
+    WCTAssert(m_selectLowerBoundStatement->isPrepared()
+              && m_migrateStatement->isPrepared()
+              && m_removeMigratedStatement->isPrepared());
+    WCTAssert(getHandle()->isInTransaction());
+    Optional<bool> migrated;
+    m_selectLowerBoundStatement->bindInteger(m_batchCount - 1, 1);
+    if (m_selectLowerBoundStatement->step()) {
+        // Less than one batch of rows left. Migrate all of them.
+        int64_t lowerBound = m_selectLowerBoundStatement->done() ?
+                             std::numeric_limits<int64_t>::min() :
+                             m_selectLowerBoundStatement->getInteger(0);
+        m_migrateStatement->bindInteger(lowerBound, 1);
+        m_removeMigratedStatement->bindInteger(lowerBound, 1);
+        if (m_migrateStatement->step() && m_removeMigratedStatement->step()) {
+            // Nothing is deleted only when the source table is empty.
+            migrated = getHandle()->getChanges() == 0;
+        }
+    }
+    m_selectLowerBoundStatement->reset();
+    m_migrateStatement->reset();
+    m_removeMigratedStatement->reset();
+    return migrated;
+}
+
+void MigrateHandleOperator::adjustBatchCount(double cost, double timeIntervalWithinTransaction)
+{
+    // Fit several ranges into one transaction so that it can still be finished in time.
+    if (cost > timeIntervalWithinTransaction / 2) {
+        m_batchCount = std::max(m_batchCount / 2, 1);
+    } else if (cost < timeIntervalWithinTransaction / 4) {
+        m_batchCount = std::min(m_batchCount * 2, MigrateMaxBatchCount);
+    }
 }
 
 #pragma mark - Sample
@@ -35,6 +35,8 @@ namespace WCDB {
 // However, it's very wasteful for those resources(CPU, IO...) when the step is too small.
 // So stepper will try to migrate one by one until the count of dirty pages(to be written) is changed.
 // In addition, stepper can/will be interrupted when database is not idled.
+// With range migration enabled, stepper moves a range of rows with one INSERT...SELECT and one DELETE,
+// and adapts the size of the range to the time allowed by the samples.
 class MigrateHandleOperator final : public HandleOperator, public Migration::Stepper {
 public:
     MigrateHandleOperator(InnerHandle* handle);
@@ -59,6 +61,7 @@ protected:
     Optional<bool> migrateRow();
 
     bool reAttachMigrationInfo(const MigrationInfo* info);
+    bool prepareMigrationStatement();
     void finalizeMigrationStatement();
 
 private:
@@ -66,6 +69,19 @@ private:
     HandleStatement* m_migrateStatement;
     HandleStatement* m_removeMigratedStatement;
 
+#pragma mark - Range
+public:
+    void setMigratesByRange(bool enable);
+
+protected:
+    Optional<bool> migrateRange();
+    void adjustBatchCount(double cost, double timeIntervalWithinTransaction);
+
+private:
+    bool m_migratesByRange;
+    int m_batchCount;
+    HandleStatement* m_selectLowerBoundStatement;
+
 #pragma mark - Sample
 protected:
     void addSample(double timeIntervalWithinTransaction, double timeIntervalForWholeTransaction);
@@ -25,6 +25,7 @@
 #include "MigratingStatementDecorator.hpp"
 #include "Assertion.hpp"
 #include "CommonCore.hpp"
+#include "CoreConst.h"
 #include "SQLite.h"
 #include "StringView.hpp"
 #include "WINQ.h"
@@ -275,6 +276,28 @@ MigratingStatementDecorator::process(const Statement& originStatement)
                 stmt.schema = Schema::main();
             }
         } break;
+        case Syntax::Identifier::Type::SelectSTMT: {
+            // Read the migrating table from both of the source table and the target table directly,
+            // instead of the unioned view, if possible.
+            // The compressing tables still use the unioned view, whose definition contains the decompression.
+            const Syntax::SelectSTMT& migratedSTMT
+            = static_cast<const Syntax::SelectSTMT&>(originStatement.syntax());
+            const MigrationInfo* info = nullptr;
+            if (!getHandleStatement()->containDecorator(DecoratorCompressingHandleStatement)
+                && migratedSTMT.select.hasValue()
+                && migratedSTMT.select->tableOrSubqueries.size() == 1) {
+                const Syntax::TableOrSubquery& table
+                = migratedSTMT.select->tableOrSubqueries.front();
+                if (table.switcher == Syntax::TableOrSubquery::Switch::Table
+                    && table.schema.isMain()) {
+                    info = m_migrationBinder->getBoundInfo(table.tableOrFunction);
+                }
+            }
+            if (info == nullptr
+                || !info->tryGenerateStatementForDualReading(falledBackStatement, statements)) {
+                statements.push_back(falledBackStatement);
+            }
+        } break;
         default:
             statements.push_back(falledBackStatement);
             break;
@@ -276,10 +276,8 @@ MigrationInfo::MigrationInfo(const MigrationUserInfo& userInfo,
 
     // Migrate
     {
-        OrderingTerm migrateOrder
-        = m_integerPrimaryKey.empty() ?
-          OrderingTerm(rowid).order(Order::DESC) :
-          OrderingTerm(Column(m_integerPrimaryKey)).order(Order::DESC);
+        Column migrateKey = m_integerPrimaryKey.empty() ? rowid : Column(m_integerPrimaryKey);
+        OrderingTerm migrateOrder = OrderingTerm(migrateKey).order(Order::DESC);
 
         m_statementForMigratingOneRow = StatementInsert()
                                         .insertIntoTable(getTable())
@@ -300,6 +298,31 @@ MigrationInfo::MigrationInfo(const MigrationUserInfo& userInfo,
 
         m_statementForSelectingAnyRowFromSourceTable
         = StatementSelect().select(Column::all()).from(sourceTableQuery).limit(1);
+
+        m_statementForSelectingLowerBoundOfRange = StatementSelect()
+                                                   .select(migrateKey)
+                                                   .from(sourceTableQuery)
+                                                   .where(m_filterCondition)
+                                                   .order(migrateOrder)
+                                                   .limit(1)
+                                                   .offset(BindParameter(1));
+
+        Expression rangeCondition = migrateKey >= BindParameter(1);
+        if (m_filterCondition.syntax().isValid()) {
+            rangeCondition = m_filterCondition && rangeCondition;
+        }
+
+        m_statementForMigratingRange = StatementInsert()
+                                       .insertIntoTable(getTable())
+                                       .orIgnore()
+                                       .columns(columns)
+                                       .values(StatementSelect()
+                                               .select(resultColumns)
+                                               .from(sourceTableQuery)
+                                               .where(rangeCondition));
+
+        m_statementForDeletingMigratedRange
+        = StatementDelete().deleteFrom(qualifiedSourceTable).where(rangeCondition);
     }
 
     // Compatible
@@ -420,6 +443,21 @@ const StatementDelete& MigrationInfo::getStatementForDeletingMigratedOneRow() co
     return m_statementForDeletingMigratedOneRow;
 }
 
+const StatementSelect& MigrationInfo::getStatementForSelectingLowerBoundOfRange() const
+{
+    return m_statementForSelectingLowerBoundOfRange;
+}
+
+const StatementInsert& MigrationInfo::getStatementForMigratingRange() const
+{
+    return m_statementForMigratingRange;
+}
+
+const StatementDelete& MigrationInfo::getStatementForDeletingMigratedRange() const
+{
+    return m_statementForDeletingMigratedRange;
+}
+
 void MigrationInfo::generateStatementsForInsertMigrating(const Statement& sourceStatement,
                                                          std::list<Statement>& statements,
                                                          int& primaryKeyIndex,
@@ -602,4 +640,230 @@ const StatementDropTable& MigrationInfo::getStatementForDroppingSourceTable() co
     return m_statementForDroppingSourceTable;
 }
 
+#pragma mark - Dual Read
+bool MigrationInfo::isDualReadable(const Syntax::SelectSTMT& select)
+{
+    if (!select.commonTableExpressions.empty() || !select.cores.empty()
+        || !select.select.hasValue()) {
+        return false;
+    }
+    const Syntax::SelectCore& core = select.select.value();
+    if (core.switcher != Syntax::SelectCore::Switch::Select || core.distinct
+        || core.resultColumns.empty() || core.tableOrSubqueries.size() != 1
+        || core.joinClause.hasValue() || !core.groups.empty()
+        || core.having.hasValue() || !core.windows.empty()) {
+        return false;
+    }
+    const Syntax::TableOrSubquery& table = core.tableOrSubqueries.front();
+    if (table.switcher != Syntax::TableOrSubquery::Switch::Table || !table.alias.empty()
+        || table.indexType != Syntax::TableOrSubquery::IndexType::NotSet) {
+        return false;
+    }
+    for (const auto& resultColumn : core.resultColumns) {
+        if (!resultColumn.expression.hasValue() || resultColumn.expression->useWildcard) {
+            return false;
+        }
+    }
+    // SQLite resolves the aliases of result columns in WHERE and ORDER BY,
+    // while the result columns are renamed in branches.
+    bool referencingAlias = false;
+    Syntax::Identifier::ConstIterator aliasIterator
+    = [&referencingAlias, &core](const Syntax::Identifier& identifier, bool isBegin, bool& stop) {
+        if (!isBegin || identifier.getType() != Syntax::Identifier::Type::Expression) {
+            return;
+        }
+        const Syntax::Expression& expression = (const Syntax::Expression&) identifier;
+        if (expression.switcher != Syntax::Expression::Switch::Column
+            || !expression.column().table.empty()) {
+            return;
+        }
+        for (const auto& resultColumn : core.resultColumns) {
+            if (!resultColumn.alias.empty()
+                && expression.column().name.caseInsensitiveEqual(resultColumn.alias)) {
+                referencingAlias = true;
+                stop = true;
+                return;
+            }
+        }
+    };
+    if (WCDB_SYNTAX_CHECK_OPTIONAL_VALID(core.condition)) {
+        static_cast<const Syntax::Identifier&>(core.condition.value()).iterate(aliasIterator);
+    }
+    for (const auto& orderingTerm : select.orderingTerms) {
+        // Ordering terms that refer to the positions of result columns can't be moved into branches.
+        if (!orderingTerm.expression.hasValue()) {
+            return false;
+        }
+        const Syntax::Expression& expression = orderingTerm.expression.value();
+        if (expression.switcher == Syntax::Expression::Switch::LiteralValue) {
+            return false;
+        }
+        if (!referencingAlias) {
+            static_cast<const Syntax::Identifier&>(expression).iterate(aliasIterator);
+        }
+    }
+    if (referencingAlias) {
+        return false;
+    }
+    bool dualReadable = true;
+    Syntax::Identifier::ConstIterator iterator
+    = [&dualReadable](const Syntax::Identifier& identifier, bool isBegin, bool& stop) {
+        if (!isBegin || identifier.getType() != Syntax::Identifier::Type::Expression) {
+            return;
+        }
+        const Syntax::Expression& expression = (const Syntax::Expression&) identifier;
+        switch (expression.switcher) {
+        case Syntax::Expression::Switch::Column:
+            // Qualified columns may refer to the unioned view.
+            dualReadable
+            = !expression.column().wildcard && expression.column().table.empty();
+            break;
+        case Syntax::Expression::Switch::Function: {
+            // Aggregations can't be merged from two branches.
+            const StringView& function = expression.function();
+            bool aggregation = function.caseInsensitiveEqual("count")
+                               || function.caseInsensitiveEqual("avg")
+                               || function.caseInsensitiveEqual("sum")
+                               || function.caseInsensitiveEqual("total")
+                               || function.caseInsensitiveEqual("group_concat")
+                               || ((function.caseInsensitiveEqual("max")
+                                    || function.caseInsensitiveEqual("min"))
+                                   && expression.expressions.size() < 2);
+            dualReadable = !aggregation;
+        } break;
+        case Syntax::Expression::Switch::BindParameter: {
+            // Each copy of an unnumbered parameter in branches is numbered separately by SQLite,
+            // so that only the first one of them would be bound.
+            const Syntax::BindParameter& bindParameter = expression.bindParameter();
+            dualReadable
+            = bindParameter.switcher != Syntax::BindParameter::Switch::QuestionSign
+              || bindParameter.n > 0;
+        } break;
+        case Syntax::Expression::Switch::Window:
+            dualReadable = false;
+            break;
+        default:
+            break;
+        }
+        if (!dualReadable) {
+            stop = true;
+        }
+    };
+    // The select is walked in place, since it's checked on every prepare of a select on migrating table.
+    static_cast<const Syntax::Identifier&>(select).iterate(iterator);
+    return dualReadable;
+}
+
+bool MigrationInfo::tryGenerateStatementForDualReading(const Statement& sourceStatement,
+                                                       std::list<Statement>& statements) const
+{
+    WCTAssert(sourceStatement.getType() == Syntax::Identifier::Type::SelectSTMT);
+    const Syntax::SelectSTMT& selectSyntax
+    = static_cast<const Syntax::SelectSTMT&>(sourceStatement.syntax());
+    if (!isDualReadable(selectSyntax)) {
+        return false;
+    }
+    const Syntax::SelectCore& coreSyntax = selectSyntax.select.value();
+
+    ResultColumns branchColumns;
+    ResultColumns resultColumns;
+    int index = 0;
+    for (const auto& resultColumn : coreSyntax.resultColumns) {
+        StringView name = StringView::formatted("wcdb_column_%d", index++);
+        Expression expression;
+        expression.syntax() = resultColumn.expression.value();
+        branchColumns.push_back(expression.as(name));
+        // Keep the names of result columns the same as the origin statement.
+        StringView alias = resultColumn.alias;
+        if (alias.empty()) {
+            alias = expression.syntax().switcher == Syntax::Expression::Switch::Column ?
+                    expression.syntax().column().name :
+                    expression.getDescription();
+        }
+        resultColumns.push_back(Column(name).as(alias));
+    }
+
+    OrderingTerms orderingTerms;
+    index = 0;
+    for (const auto& orderingTerm : selectSyntax.orderingTerms) {
+        StringView name = StringView::formatted("wcdb_order_%d", index++);
+        Expression expression;
+        expression.syntax() = orderingTerm.expression.value();
+        branchColumns.push_back(expression.as(name));
+        OrderingTerm mergedOrderingTerm;
+        mergedOrderingTerm.syntax() = orderingTerm;
+        mergedOrderingTerm.syntax().expression = Expression(Column(name)).syntax();
+        orderingTerms.push_back(mergedOrderingTerm);
+    }
+
+    // Each branch should provide enough rows for both the limit and the offset of the merged result.
+    Optional<Expression> branchLimit;
+    if (WCDB_SYNTAX_CHECK_OPTIONAL_VALID(selectSyntax.limit)) {
+        Expression limit;
+        Expression offset;
+        switch (selectSyntax.limitParameterType) {
+        case Syntax::LimitParameterType::NotSet:
+            limit.syntax() = selectSyntax.limit.value();
+            branchLimit = limit;
+            break;
+        case Syntax::LimitParameterType::Offset:
+            limit.syntax() = selectSyntax.limit.value();
+            offset.syntax() = selectSyntax.limitParameter.value();
+            break;
+        case Syntax::LimitParameterType::End:
+            offset.syntax() = selectSyntax.limit.value();
+            limit.syntax() = selectSyntax.limitParameter.value();
+            break;
+        }
+        if (!branchLimit.hasValue()) {
+            branchLimit = Expression::case_().when(limit < 0).then(-1).else_(limit + offset);
+        }
+    }
+
+    Expression condition;
+    if (WCDB_SYNTAX_CHECK_OPTIONAL_VALID(coreSyntax.condition)) {
+        condition.syntax() = coreSyntax.condition.value();
+    }
+    Expression sourceCondition = condition;
+    if (m_filterCondition.syntax().isValid()) {
+        sourceCondition = condition.syntax().isValid() ?
+                          condition && m_filterCondition :
+                          m_filterCondition;
+    }
+
+    StatementSelect targetBranch = StatementSelect()
+                                   .select(branchColumns)
+                                   .from(TableOrSubquery(m_table).schema(Schema::main()))
+                                   .where(condition);
+    StatementSelect sourceBranch
+    = StatementSelect()
+      .select(branchColumns)
+      .from(TableOrSubquery(getSourceTable()).schema(getSchemaForSourceDatabase()))
+      .where(sourceCondition);
+    if (branchLimit.hasValue()) {
+        targetBranch.syntax().orderingTerms = selectSyntax.orderingTerms;
+        targetBranch.limit(branchLimit.value());
+        sourceBranch.syntax().orderingTerms = selectSyntax.orderingTerms;
+        sourceBranch.limit(branchLimit.value());
+    }
+
+    StatementSelect branches = StatementSelect()
+                               .select(Column::all())
+                               .from(targetBranch)
+                               .unionAll()
+                               .select(Column::all())
+                               .from(sourceBranch);
+
+    statements.push_back(StatementSelect().select(resultColumns).from(branches));
+    StatementSelect& merged = static_cast<StatementSelect&>(statements.back());
+    if (!orderingTerms.empty()) {
+        merged.orders(orderingTerms);
+    }
+    Syntax::SelectSTMT& mergedSyntax = merged.syntax();
+    mergedSyntax.limit = selectSyntax.limit;
+    mergedSyntax.limitParameterType = selectSyntax.limitParameterType;
+    mergedSyntax.limitParameter = selectSyntax.limitParameter;
+    return true;
+}
+
 } // namespace WCDB
@@ -242,6 +242,27 @@ protected:
     StatementDelete m_statementForDeletingSpecifiedRow;
     StatementSelect m_statementForSelectingMaxID;
 
+#pragma mark - Dual Read
+public:
+    /*
+     SELECT wcdb_column_0 AS [resultColumn], ...
+     FROM (SELECT * FROM (SELECT [resultColumns], [orders] FROM main.[table] WHERE ... ORDER BY ... LIMIT [limit + offset])
+           UNION ALL
+           SELECT * FROM (SELECT [resultColumns], [orders] FROM [schemaForSourceDatabase].[sourceTable] WHERE ... AND [filter] ORDER BY ... LIMIT [limit + offset]))
+     ORDER BY wcdb_order_0, ... LIMIT ... OFFSET ...
+     
+     Each branch reads its own table directly, so that the indexes still work for ORDER BY and LIMIT.
+     It returns false and generates nothing if the select is too complex to be split, e.g. joins, aggregations, qualified columns,
+     unnumbered bind parameters that are copied into both branches
+     and the references to the aliases of result columns in WHERE or ORDER BY.
+     Then temp.[unionedView] should be used instead.
+     */
+    bool tryGenerateStatementForDualReading(const Statement& sourceStatement,
+                                            std::list<Statement>& statements) const;
+
+protected:
+    static bool isDualReadable(const Syntax::SelectSTMT& select);
+
 #pragma mark - Migrate
 public:
     /*
@@ -265,6 +286,31 @@ public:
      */
     const StatementDelete& getStatementForDeletingMigratedOneRow() const;
 
+    /*
+     SELECT [rowid/primary key]
+     FROM [schemaForSourceDatabase].[sourceTable]
+     ORDER BY [rowid/primary key] DESC
+     LIMIT 1 OFFSET ?1
+     
+     It finds the lower bound of the next range to be migrated, which contains at most ?1 + 1 rows.
+     */
+    const StatementSelect& getStatementForSelectingLowerBoundOfRange() const;
+
+    /*
+     INSERT [columns]
+     INTO rowid, main.[table]
+     SELECT rowid, [columns]
+     FROM [schemaForSourceDatabase].[sourceTable]
+     WHERE [rowid/primary key] >= ?1
+     */
+    const StatementInsert& getStatementForMigratingRange() const;
+
+    /*
+     DELETE FROM [schemaForSourceDatabase].[sourceTable]
+     WHERE [rowid/primary key] >= ?1
+     */
+    const StatementDelete& getStatementForDeletingMigratedRange() const;
+
     /*
      SELECT * FROM [schemaForSourceDatabase].[sourceTable] LIMIT 1
      */
@@ -278,6 +324,9 @@ public:
 protected:
     StatementInsert m_statementForMigratingOneRow;
     StatementDelete m_statementForDeletingMigratedOneRow;
+    StatementSelect m_statementForSelectingLowerBoundOfRange;
+    StatementInsert m_statementForMigratingRange;
+    StatementDelete m_statementForDeletingMigratedRange;
     StatementDropTable m_statementForDroppingSourceTable;
     StatementSelect m_statementForSelectingAnyRowFromSourceTable;
 };
@@ -30,6 +30,7 @@
 #include "FileManager.hpp"
 #include "Global.hpp"
 #include "Notifier.hpp"
+#include <algorithm>
 #include <fcntl.h>
 
 namespace WCDB {
@@ -39,6 +40,11 @@ OperationEvent::~OperationEvent() = default;
 OperationQueue::OperationQueue(const UnsafeStringView& name, OperationEvent* event)
 : AsyncQueue(name)
 , m_event(event)
+, m_numberOfWorkers(OperationQueueDefaultNumberOfWorkers)
+, m_numberOfLiveWorkers(0)
+, m_workersStarted(false)
+, m_workersStopped(false)
+, m_purging(false)
 , m_observerForMemoryWarning(registerNotificationWhenMemoryWarning())
 {
     Notifier::shared().setNotification(
@@ -69,22 +75,22 @@ void OperationQueue::stopAllDatabaseEvent(const UnsafeStringView& path)
 {
     LockGuard lockGuard(m_lock);
     Operation integerity(Operation::Type::Integrity, path);
-    m_timedQueue.remove(integerity);
+    cancel(integerity);
 
     Operation checkpoint(Operation::Type::Checkpoint, path);
-    m_timedQueue.remove(checkpoint);
+    cancel(checkpoint);
 
     Operation backup(Operation::Type::Backup, path);
-    m_timedQueue.remove(backup);
+    cancel(backup);
 
     Operation migrate(Operation::Type::Migrate, path);
-    m_timedQueue.remove(migrate);
+    cancel(migrate);
 
     Operation compress(Operation::Type::Compress, path);
-    m_timedQueue.remove(compress);
+    cancel(compress);
 
     Operation mergeIndex(Operation::Type::MergeIndex, path);
-    m_timedQueue.remove(mergeIndex);
+    cancel(mergeIndex);
 }
 
 void OperationQueue::stop()
@@ -94,8 +100,14 @@ void OperationQueue::stop()
 
 void OperationQueue::main()
 {
+    {
+        std::lock_guard<std::mutex> lockGuard(m_workerLock);
+        m_workersStarted = true;
+    }
+    runWorkersIfNeeded();
     m_timedQueue.loop(std::bind(
-    &OperationQueue::onTimed, this, std::placeholders::_1, std::placeholders::_2));
+    &OperationQueue::dispatch, this, std::placeholders::_1, std::placeholders::_2));
+    stopWorkers();
 }
 
 void OperationQueue::handleError(const Error& error)
@@ -196,6 +208,17 @@ bool OperationQueue::Operation::operator==(const Operation& other) const
     return equal;
 }
 
+bool OperationQueue::Operation::operator<(const Operation& other) const
+{
+    if (type != other.type) {
+        return type < other.type;
+    }
+    if (type == Type::Purge) {
+        return false;
+    }
+    return path < other.path;
+}
+
 OperationQueue::Parameter::Parameter()
 : source(Source::Other), numberOfFailures(0), identifier(0), numberOfFileDescriptors(0)
 {
@@ -245,6 +268,202 @@ void OperationQueue::async(const Operation& operation, double delay, const Param
     m_timedQueue.queue(operation, delay, parameter, mode);
 }
 
+void OperationQueue::cancel(const Operation& operation)
+{
+    m_timedQueue.remove(operation);
+
+    std::lock_guard<std::mutex> lockGuard(m_workerLock);
+    auto& waitings = m_waitings[(int) priorityOfOperation(operation)];
+    waitings.remove_if(
+    [&operation](const Waiting& waiting) { return waiting.operation == operation; });
+}
+
+#pragma mark - Worker
+OperationQueue::Statistics::Statistics()
+: numberOfPendingOperations(0)
+, numberOfWaitingOperations(0)
+, numberOfRunningOperations(0)
+, numberOfExecutedOperations(0)
+, totalLatency(0)
+, maxLatency(0)
+{
+}
+
+OperationQueue::Waiting::Waiting(const Operation& operation_, const Parameter& parameter_)
+: operation(operation_), parameter(parameter_), expired(SteadyClock::now())
+{
+}
+
+OperationQueue::Priority OperationQueue::priorityOfOperation(const Operation& operation)
+{
+    Priority priority = Priority::Default;
+    switch (operation.type) {
+    case Operation::Type::Purge:
+    case Operation::Type::NotifyCorruption:
+    case Operation::Type::Integrity:
+        priority = Priority::Urgent;
+        break;
+    case Operation::Type::Checkpoint:
+        priority = Priority::High;
+        break;
+    case Operation::Type::Backup:
+    case Operation::Type::MergeIndex:
+        priority = Priority::Default;
+        break;
+    case Operation::Type::Migrate:
+        priority = Priority::Low;
+        break;
+    case Operation::Type::Compress:
+        priority = Priority::Background;
+        break;
+    }
+    return priority;
+}
+
+void OperationQueue::setNumberOfWorkers(int numberOfWorkers)
+{
+    WCTAssert(numberOfWorkers > 0 && numberOfWorkers <= OperationQueueMaxNumberOfWorkers);
+    {
+        std::lock_guard<std::mutex> lockGuard(m_workerLock);
+        m_numberOfWorkers
+        = std::min(std::max(numberOfWorkers, 1), OperationQueueMaxNumberOfWorkers);
+    }
+    // wake up the redundant workers to exit
+    m_workerConditional.notify_all();
+    runWorkersIfNeeded();
+}
+
+OperationQueue::Statistics OperationQueue::getStatistics()
+{
+    size_t numberOfPendingOperations = m_timedQueue.size();
+
+    std::lock_guard<std::mutex> lockGuard(m_workerLock);
+    Statistics statistics = m_statistics;
+    statistics.numberOfPendingOperations = numberOfPendingOperations;
+    for (const auto& waitings : m_waitings) {
+        statistics.numberOfWaitingOperations += waitings.size();
+    }
+    statistics.numberOfRunningOperations = m_runningPaths.size();
+    return statistics;
+}
+
+void OperationQueue::dispatch(const Operation& operation, const Parameter& parameter)
+{
+    {
+        std::lock_guard<std::mutex> lockGuard(m_workerLock);
+        if (m_workersStopped) {
+            return;
+        }
+        auto& waitings = m_waitings[(int) priorityOfOperation(operation)];
+        auto iter = std::find_if(
+        waitings.begin(), waitings.end(), [&operation](const Waiting& waiting) {
+            return waiting.operation == operation;
+        });
+        if (iter != waitings.end()) {
+            // The same operation is still waiting for its database. Keep its position
+            // and take the latest parameter, just like the forward only mode of timed queue.
+            iter->parameter = parameter;
+        } else {
+            waitings.emplace_back(operation, parameter);
+        }
+    }
+    m_workerConditional.notify_one();
+}
+
+void OperationQueue::runWorkersIfNeeded()
+{
+    std::lock_guard<std::mutex> lockGuard(m_workerLock);
+    if (!m_workersStarted || m_workersStopped) {
+        return;
+    }
+    for (auto iter = m_workers.begin(); iter != m_workers.end();) {
+        if (iter->wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+            iter = m_workers.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+    while (m_numberOfLiveWorkers < m_numberOfWorkers) {
+        ++m_numberOfLiveWorkers;
+        m_workers.push_back(std::async(std::launch::async, &OperationQueue::work, this));
+    }
+}
+
+void OperationQueue::stopWorkers()
+{
+    std::list<std::future<void>> workers;
+    {
+        std::lock_guard<std::mutex> lockGuard(m_workerLock);
+        m_workersStopped = true;
+        for (auto& waitings : m_waitings) {
+            waitings.clear();
+        }
+        workers.swap(m_workers);
+    }
+    m_workerConditional.notify_all();
+    for (auto& worker : workers) {
+        worker.wait();
+    }
+}
+
+void OperationQueue::work()
+{
+    Thread::setName(name);
+
+    std::unique_lock<std::mutex> lockGuard(m_workerLock);
+    while (!m_workersStopped && !isExiting() && m_numberOfLiveWorkers <= m_numberOfWorkers) {
+        // Purge closes the idle handles of all databases, so it is run exclusively.
+        // Once it is waiting, no other operation is started until it's done, to avoid starving it.
+        const auto& urgents = m_waitings[(int) Priority::Urgent];
+        bool exclusive = m_purging
+                         || std::any_of(urgents.begin(), urgents.end(), [](const Waiting& waiting) {
+                                return waiting.operation.type == Operation::Type::Purge;
+                            });
+        std::list<Waiting> runnings;
+        for (auto& waitings : m_waitings) {
+            auto iter = std::find_if(
+            waitings.begin(), waitings.end(), [this, exclusive](const Waiting& waiting) {
+                if (waiting.operation.type == Operation::Type::Purge) {
+                    return m_runningPaths.empty();
+                }
+                return !exclusive
+                       && m_runningPaths.find(waiting.operation.path)
+                          == m_runningPaths.end();
+            });
+            if (iter != waitings.end()) {
+                runnings.splice(runnings.end(), waitings, iter);
+                break;
+            }
+        }
+        if (runnings.empty()) {
+            m_workerConditional.wait(lockGuard);
+            continue;
+        }
+        const Waiting& running = runnings.front();
+        bool purge = running.operation.type == Operation::Type::Purge;
+        if (purge) {
+            m_purging = true;
+        }
+        m_runningPaths.emplace(running.operation.path);
+        double latency = SteadyClock::timeIntervalSinceSteadyClockToNow(running.expired);
+        m_statistics.totalLatency += latency;
+        m_statistics.maxLatency = std::max(m_statistics.maxLatency, latency);
+
+        lockGuard.unlock();
+        onTimed(running.operation, running.parameter);
+        lockGuard.lock();
+
+        m_runningPaths.erase(running.operation.path);
+        if (purge) {
+            m_purging = false;
+        }
+        ++m_statistics.numberOfExecutedOperations;
+        // operations blocked by this database can be run now
+        m_workerConditional.notify_all();
+    }
+    --m_numberOfLiveWorkers;
+}
+
 #pragma mark - Record
 OperationQueue::Record::Record()
 : registeredForMigration(false)
@@ -270,7 +489,7 @@ void OperationQueue::registerAsNoMigrationRequired(const UnsafeStringView& path)
     LockGuard lockGuard(m_lock);
     m_records[path].registeredForMigration = false;
     Operation operation(Operation::Type::Migrate, path);
-    m_timedQueue.remove(operation);
+    cancel(operation);
 }
 
 void OperationQueue::asyncMigrate(const UnsafeStringView& path)
@@ -282,7 +501,7 @@ void OperationQueue::stopMigrate(const UnsafeStringView& path)
 {
     LockGuard lockGuard(m_lock);
     Operation operation(Operation::Type::Migrate, path);
-    m_timedQueue.remove(operation);
+    cancel(operation);
 }
 
 void OperationQueue::asyncMigrate(const UnsafeStringView& path, double delay, int numberOfFailures)
@@ -292,7 +511,8 @@ void OperationQueue::asyncMigrate(const UnsafeStringView& path, double delay, in
               && numberOfFailures < OperationQueueTolerableFailuresForMigration);
 
     SharedLockGuard lockGuard(m_lock);
-    if (m_records[path].registeredForMigration) {
+    auto iter = m_records.find(path);
+    if (iter != m_records.end() && iter->second.registeredForMigration) {
         Operation operation(Operation::Type::Migrate, path);
         Parameter parameter;
         parameter.numberOfFailures = numberOfFailures;
@@ -342,7 +562,7 @@ void OperationQueue::registerAsNoCompressionRequired(const UnsafeStringView& pat
     LockGuard lockGuard(m_lock);
     m_records[path].registeredForCompression = false;
     Operation operation(Operation::Type::Compress, path);
-    m_timedQueue.remove(operation);
+    cancel(operation);
 }
 
 void OperationQueue::asyncCompress(const UnsafeStringView& path)
@@ -354,7 +574,7 @@ void OperationQueue::stopCompress(const UnsafeStringView& path)
 {
     LockGuard lockGuard(m_lock);
     Operation operation(Operation::Type::Compress, path);
-    m_timedQueue.remove(operation);
+    cancel(operation);
 }
 
 void OperationQueue::asyncCompress(const UnsafeStringView& path, double delay, int numberOfFailures)
@@ -364,7 +584,8 @@ void OperationQueue::asyncCompress(const UnsafeStringView& path, double delay, i
               && numberOfFailures < OperationQueueTolerableFailuresForCompression);
 
     SharedLockGuard lockGuard(m_lock);
-    if (m_records[path].registeredForCompression) {
+    auto iter = m_records.find(path);
+    if (iter != m_records.end() && iter->second.registeredForCompression) {
         Operation operation(Operation::Type::Compress, path);
         Parameter parameter;
         parameter.numberOfFailures = numberOfFailures;
@@ -414,7 +635,7 @@ void OperationQueue::registerAsNoMergeFTSIndexRequired(const UnsafeStringView& p
     LockGuard lockGuard(m_lock);
     m_records[path].registeredForMergeFTSIndex = false;
     Operation operation(Operation::Type::MergeIndex, path);
-    m_timedQueue.remove(operation);
+    cancel(operation);
 }
 
 void OperationQueue::asyncMergeFTSIndex(const UnsafeStringView& path,
@@ -422,7 +643,8 @@ void OperationQueue::asyncMergeFTSIndex(const UnsafeStringView& path,
                                         TableArray modifiedTables)
 {
     SharedLockGuard lockGuard(m_lock);
-    if (m_records[path].registeredForMergeFTSIndex) {
+    auto iter = m_records.find(path);
+    if (iter != m_records.end() && iter->second.registeredForMergeFTSIndex) {
         Operation operation(Operation::Type::MergeIndex, path);
         Parameter parameter;
         parameter.newTables = newTables;
@@ -446,7 +668,8 @@ bool OperationQueue::isAutoBackup(const UnsafeStringView& path)
     WCTAssert(!path.empty());
 
     SharedLockGuard lockGuard(m_lock);
-    return m_records[path].registeredForBackup;
+    auto iter = m_records.find(path);
+    return iter != m_records.end() && iter->second.registeredForBackup;
 }
 
 void OperationQueue::registerAsRequiredBackup(const UnsafeStringView& path)
@@ -464,7 +687,7 @@ void OperationQueue::registerAsNoBackupRequired(const UnsafeStringView& path)
     LockGuard lockGuard(m_lock);
     m_records[path].registeredForBackup = false;
     Operation operation(Operation::Type::Backup, path);
-    m_timedQueue.remove(operation);
+    cancel(operation);
 }
 
 void OperationQueue::asyncBackup(const UnsafeStringView& path, bool incremental)
@@ -511,10 +734,10 @@ void OperationQueue::registerAsNoCheckpointRequired(const UnsafeStringView& path
     m_records[path].registeredForCheckpoint = false;
 
     Operation operation(Operation::Type::Checkpoint, path);
-    m_timedQueue.remove(operation);
+    cancel(operation);
 }
 
-void OperationQueue::asyncCheckpoint(const UnsafeStringView& path)
+void OperationQueue::asyncCheckpoint(const UnsafeStringView& path, double delay)
 {
     WCTAssert(!path.empty());
 
@@ -523,12 +746,16 @@ void OperationQueue::asyncCheckpoint(const UnsafeStringView& path)
     if (iter != m_records.end() && iter->second.registeredForCheckpoint) {
         Operation operation(Operation::Type::Checkpoint, path);
         Parameter parameter;
-        double checkPointInterval = OperationQueueTimeIntervalForCheckpoint;
-        auto config = CommonCore::shared().getABTestConfig("clicfg_wcdb_checkpoint_interval");
-        if (config.valueOrDefault().length() > 0) {
-            checkPointInterval = std::max(checkPointInterval, atof(config->data()));
-            checkPointInterval = std::min(checkPointInterval, 600.0);
+        double checkPointInterval = delay;
+        // Urgent checkpoints are not delayed by the config.
+        if (checkPointInterval >= OperationQueueTimeIntervalForCheckpoint) {
+            auto config = CommonCore::shared().getABTestConfig("clicfg_wcdb_checkpoint_interval");
+            if (config.valueOrDefault().length() > 0) {
+                checkPointInterval = std::max(checkPointInterval, atof(config->data()));
+            }
         }
+        checkPointInterval
+        = std::min(checkPointInterval, OperationQueueMaxTimeIntervalForCheckpoint);
         async(operation, checkPointInterval, parameter, AsyncMode::ForwardOnly);
     }
 }
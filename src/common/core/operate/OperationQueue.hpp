@@ -29,6 +29,8 @@
 #include "StringView.hpp"
 #include "Time.hpp"
 #include "TimedQueue.hpp"
+#include <future>
+#include <list>
 #include <map>
 #include <set>
 
@@ -109,6 +111,7 @@ protected:
         Operation(Type type, const UnsafeStringView& path);
 
         bool operator==(const Operation& other) const;
+        bool operator<(const Operation& other) const;
     };
     typedef struct Operation Operation;
 
@@ -137,8 +140,69 @@ protected:
                double delay,
                const Parameter& parameter,
                AsyncMode mode = AsyncMode::ForwardOnly);
+    void cancel(const Operation& operation);
     TimedQueue<Operation, Parameter> m_timedQueue;
 
+#pragma mark - Worker
+public:
+    // Expired operations are run by a pool of workers.
+    // Operations of the same database are never run concurrently,
+    // and the ones with higher priority are run first.
+    // Purge is run when no other operation is running.
+    void setNumberOfWorkers(int numberOfWorkers);
+
+    struct Statistics {
+        Statistics();
+        // operations that are not expired yet
+        size_t numberOfPendingOperations;
+        // operations that are expired but not run yet
+        size_t numberOfWaitingOperations;
+        size_t numberOfRunningOperations;
+        uint64_t numberOfExecutedOperations;
+        // seconds from expired to run
+        double totalLatency;
+        double maxLatency;
+    };
+    typedef struct Statistics Statistics;
+    Statistics getStatistics();
+
+protected:
+    enum class Priority {
+        Urgent = 0,
+        High,
+        Default,
+        Low,
+        Background,
+    };
+    static constexpr const int NumberOfPriorities = (int) Priority::Background + 1;
+    static Priority priorityOfOperation(const Operation& operation);
+
+    struct Waiting {
+        Waiting(const Operation& operation, const Parameter& parameter);
+        const Operation operation;
+        Parameter parameter;
+        SteadyClock expired;
+    };
+    typedef struct Waiting Waiting;
+
+    void dispatch(const Operation& operation, const Parameter& parameter);
+    void stopWorkers();
+    void runWorkersIfNeeded();
+    void work();
+
+    std::mutex m_workerLock;
+    Conditional m_workerConditional;
+    std::list<Waiting> m_waitings[NumberOfPriorities];
+    // paths of databases with a running operation
+    std::set<StringView> m_runningPaths;
+    std::list<std::future<void>> m_workers;
+    int m_numberOfWorkers;
+    int m_numberOfLiveWorkers;
+    bool m_workersStarted;
+    bool m_workersStopped;
+    bool m_purging;
+    Statistics m_statistics;
+
 #pragma mark - Record
 protected:
     struct Record {
@@ -203,7 +267,7 @@ public:
     void registerAsRequiredCheckpoint(const UnsafeStringView& path);
     void registerAsNoCheckpointRequired(const UnsafeStringView& path);
 
-    void asyncCheckpoint(const UnsafeStringView& path) override final;
+    void asyncCheckpoint(const UnsafeStringView& path, double delay) override final;
 
 protected:
     void doCheckpoint(const UnsafeStringView& path);
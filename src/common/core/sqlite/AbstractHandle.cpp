@@ -27,8 +27,10 @@
 #include "CoreConst.h"
 #include "Notifier.hpp"
 #include "Path.hpp"
+#include "SQLWriter.hpp"
 #include "SQLite.h"
 #include "StringView.hpp"
+#include <cstring>
 
 namespace WCDB {
 
@@ -37,6 +39,9 @@ AbstractHandle::AbstractHandle()
 : m_handle(nullptr)
 , m_customOpenFlag(0)
 , m_tag(Tag::invalid())
+, m_maxPreparedStatementCount(0)
+, m_maxPreparedStatementMemory(0)
+, m_preparedStatementMemory(0)
 , m_transactionLevel(0)
 , m_transactionError(TransactionError::Allowed)
 , m_cacheTransactionError(TransactionError::Allowed)
@@ -247,11 +252,13 @@ void AbstractHandle::resetAllStatements()
 
 void AbstractHandle::finalizeStatements()
 {
-    for (const auto &iter : m_preparedStatements) {
-        iter.second->finalize();
-        returnStatement(iter.second);
+    for (const auto &entry : m_preparedStatementList) {
+        entry.handleStatement->finalize();
+        returnStatement(entry.handleStatement);
     }
+    m_preparedStatementList.clear();
     m_preparedStatements.clear();
+    m_preparedStatementMemory = 0;
     for (auto &handleStatement : m_handleStatements) {
         handleStatement.finalize();
     }
@@ -259,46 +266,229 @@ void AbstractHandle::finalizeStatements()
 
 HandleStatement *AbstractHandle::getOrCreatePreparedStatement(const Statement &statement)
 {
-    const StringView &sql = statement.getDescription();
-    HandleStatement *preparedStatement = getOrCreateStatement(sql);
+    auto entry = getOrCreatePreparedStatementEntry(statement);
+    if (entry == m_preparedStatementList.end()) {
+        return nullptr;
+    }
+    entry->pinned = true;
+    return entry->handleStatement;
+}
 
-    if (preparedStatement == nullptr
-        || (!preparedStatement->isPrepared() && !preparedStatement->prepare(statement))) {
+HandleStatement *
+AbstractHandle::getOrCreatePreparedStatement(const Statement &statement,
+                                             PreparedStatementReference &reference)
+{
+    auto entry = getOrCreatePreparedStatementEntry(statement);
+    if (entry == m_preparedStatementList.end()) {
         return nullptr;
     }
-    return preparedStatement;
+    if (entry->reference == nullptr) {
+        entry->reference = std::make_shared<bool>(true);
+    }
+    reference = entry->reference;
+    return entry->handleStatement;
 }
 
-HandleStatement *AbstractHandle::getOrCreatePreparedStatement(const UnsafeStringView &sql)
+AbstractHandle::PreparedStatementList::iterator
+AbstractHandle::getOrCreatePreparedStatementEntry(const Statement &statement)
 {
-    HandleStatement *preparedStatement = getOrCreateStatement(sql);
+    PreparedStatementList::iterator entry;
+    if (isFingerprintedStatement(statement)) {
+        // DML statements are usually rebuilt per call by the chain calls,
+        // so that they are looked up by fingerprint without generating their SQLs.
+        if (!checkPreparedStatementValid(statement.syntax().isValid())) {
+            return m_preparedStatementList.end();
+        }
+        Syntax::FingerprintWriter writer;
+        writer.writeTree(statement.syntax());
+        entry = findPreparedStatement(writer.written(), true);
+        if (entry == m_preparedStatementList.end()) {
+            entry = createPreparedStatement(writer.written(), true);
+            entry->statement = statement;
+        }
+    } else {
+        // Statements rebuilt per call are looked up without allocating and caching their descriptions.
+        Syntax::SQLWriter writer;
+        UnsafeStringView sql = statement.getDescription(writer);
+        if (!checkPreparedStatementValid(sql.length() > 0)) {
+            return m_preparedStatementList.end();
+        }
+        entry = findPreparedStatement(sql, false);
+        if (entry == m_preparedStatementList.end()) {
+            entry = createPreparedStatement(sql, false);
+            entry->statement = statement;
+        }
+    }
+    if (!prepareCachedStatement(entry)) {
+        return m_preparedStatementList.end();
+    }
+    return entry;
+}
 
-    if (preparedStatement == nullptr
-        || (!preparedStatement->isPrepared() && !preparedStatement->prepareSQL(sql))) {
+HandleStatement *AbstractHandle::getOrCreatePreparedStatement(const UnsafeStringView &sql)
+{
+    if (!checkPreparedStatementValid(sql.length() > 0)) {
+        return nullptr;
+    }
+    auto entry = findPreparedStatement(sql, false);
+    if (entry == m_preparedStatementList.end()) {
+        entry = createPreparedStatement(sql, false);
+    }
+    if (!prepareCachedStatement(entry)) {
         return nullptr;
     }
-    return preparedStatement;
+    entry->pinned = true;
+    return entry->handleStatement;
 }
 
-HandleStatement *AbstractHandle::getOrCreateStatement(const UnsafeStringView &sql)
+AbstractHandle::PreparedStatementEntry::PreparedStatementEntry(
+const UnsafeStringView &key_, bool fingerprinted_, DecorativeHandleStatement *handleStatement_)
+: key(key_)
+, fingerprinted(fingerprinted_)
+, handleStatement(handleStatement_)
+, memoryUsed(0)
+, pinned(false)
 {
-    if (sql.length() == 0) {
+}
+
+bool AbstractHandle::isFingerprintedStatement(const Statement &statement)
+{
+    switch (statement.getType()) {
+    case Syntax::Identifier::Type::SelectSTMT:
+    case Syntax::Identifier::Type::InsertSTMT:
+    case Syntax::Identifier::Type::UpdateSTMT:
+    case Syntax::Identifier::Type::DeleteSTMT:
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool AbstractHandle::checkPreparedStatementValid(bool valid)
+{
+    if (!valid) {
         m_error.setCode(Error::Code::Error, "Invalid statement");
         m_error.infos.erase(ErrorStringKeySQL);
         m_error.level = Error::Level::Error;
         Notifier::shared().notify(m_error);
-        return nullptr;
+        return false;
     }
-    auto iter = m_preparedStatements.find(sql);
-    DecorativeHandleStatement *handleStatement;
-    if (iter == m_preparedStatements.end()) {
-        handleStatement = getStatement();
-        m_preparedStatements[sql] = handleStatement;
-    } else {
-        handleStatement = iter->second;
+    return true;
+}
+
+AbstractHandle::PreparedStatementList::iterator
+AbstractHandle::findPreparedStatement(const UnsafeStringView &key, bool fingerprinted)
+{
+    auto range = m_preparedStatements.equal_range(key.hash());
+    for (auto iter = range.first; iter != range.second; ++iter) {
+        auto entry = iter->second;
+        // Fingerprints are binary, so that they are compared by bytes.
+        if (entry->fingerprinted != fingerprinted || entry->key.length() != key.length()
+            || memcmp(entry->key.data(), key.data(), key.length()) != 0) {
+            continue;
+        }
+        ++m_preparedStatementStatistics.hitCount;
+        m_preparedStatementList.splice(
+        m_preparedStatementList.begin(), m_preparedStatementList, entry);
+        return entry;
     }
+    return m_preparedStatementList.end();
+}
+
+AbstractHandle::PreparedStatementList::iterator
+AbstractHandle::createPreparedStatement(const UnsafeStringView &key, bool fingerprinted)
+{
+    ++m_preparedStatementStatistics.missCount;
+    DecorativeHandleStatement *handleStatement = getStatement();
     WCTAssert(handleStatement != nullptr);
-    return handleStatement;
+    m_preparedStatementList.emplace_front(key, fingerprinted, handleStatement);
+    m_preparedStatements.emplace(key.hash(), m_preparedStatementList.begin());
+    return m_preparedStatementList.begin();
+}
+
+bool AbstractHandle::prepareCachedStatement(PreparedStatementList::iterator entry)
+{
+    DecorativeHandleStatement *handleStatement = entry->handleStatement;
+    if (handleStatement->isPrepared()) {
+        return true;
+    }
+    bool succeed;
+    if (entry->statement.hasValue()) {
+        succeed = handleStatement->prepare(entry->statement.value());
+    } else {
+        succeed = handleStatement->prepareSQL(entry->key);
+    }
+    // The memory of a statement finalized by its caller is still counted until it's prepared again.
+    m_preparedStatementMemory -= entry->memoryUsed;
+    entry->memoryUsed = 0;
+    if (!succeed) {
+        return false;
+    }
+    if (m_maxPreparedStatementMemory > 0) {
+        entry->memoryUsed = handleStatement->getMemoryUsed();
+        m_preparedStatementMemory += entry->memoryUsed;
+    }
+    tryEvictPreparedStatements(handleStatement);
+    return true;
+}
+
+bool AbstractHandle::isPreparedStatementCacheOverBudget() const
+{
+    return (m_maxPreparedStatementCount > 0
+            && m_preparedStatementList.size() > (size_t) m_maxPreparedStatementCount)
+           || (m_maxPreparedStatementMemory > 0
+               && m_preparedStatementMemory > m_maxPreparedStatementMemory);
+}
+
+void AbstractHandle::tryEvictPreparedStatements(const HandleStatement *newStatement)
+{
+    auto iter = m_preparedStatementList.end();
+    while (iter != m_preparedStatementList.begin() && isPreparedStatementCacheOverBudget()) {
+        --iter;
+        DecorativeHandleStatement *handleStatement = iter->handleStatement;
+        if (handleStatement == newStatement || iter->pinned
+            || iter->reference.use_count() > 1
+            || (handleStatement->isPrepared() && handleStatement->isBusy())) {
+            // The statement held or being stepped can not be finalized.
+            continue;
+        }
+        // Nothing holds it, so that it's released with its bindings.
+        auto range = m_preparedStatements.equal_range(iter->key.hash());
+        for (auto index = range.first; index != range.second; ++index) {
+            if (index->second == iter) {
+                m_preparedStatements.erase(index);
+                break;
+            }
+        }
+        handleStatement->finalize();
+        returnStatement(handleStatement);
+        m_preparedStatementMemory -= iter->memoryUsed;
+        iter = m_preparedStatementList.erase(iter);
+        ++m_preparedStatementStatistics.evictionCount;
+    }
+}
+
+void AbstractHandle::setPreparedStatementCacheBudget(int maxCount, size_t maxMemory)
+{
+    m_maxPreparedStatementCount = maxCount;
+    if (m_maxPreparedStatementMemory == 0 && maxMemory > 0) {
+        // Memory isn't measured without a memory budget.
+        m_preparedStatementMemory = 0;
+        for (auto &entry : m_preparedStatementList) {
+            entry.memoryUsed = entry.handleStatement->isPrepared() ?
+                               entry.handleStatement->getMemoryUsed() :
+                               0;
+            m_preparedStatementMemory += entry.memoryUsed;
+        }
+    }
+    m_maxPreparedStatementMemory = maxMemory;
+    tryEvictPreparedStatements(nullptr);
+}
+
+const AbstractHandle::PreparedStatementCacheStatistics &
+AbstractHandle::getPreparedStatementCacheStatistics() const
+{
+    return m_preparedStatementStatistics;
 }
 
 #pragma mark - Meta
@@ -608,7 +798,7 @@ void AbstractHandle::enableExtendedResultCodes(bool enable)
     APIExit(sqlite3_extended_result_codes(m_handle, (int) enable));
 }
 
-bool AbstractHandle::checkpoint(CheckpointMode mode)
+bool AbstractHandle::checkpoint(CheckpointMode mode, CheckpointResult *result)
 {
     static_assert((int) CheckpointMode::Passive == SQLITE_CHECKPOINT_PASSIVE, "");
     static_assert((int) CheckpointMode::Full == SQLITE_CHECKPOINT_FULL, "");
@@ -616,8 +806,15 @@ bool AbstractHandle::checkpoint(CheckpointMode mode)
     static_assert((int) CheckpointMode::Truncate == SQLITE_CHECKPOINT_TRUNCATE, "");
     WCTAssert(isOpened());
 
-    return APIExit(sqlite3_wal_checkpoint_v2(
-    m_handle, Syntax::mainSchema.data(), (int) mode, nullptr, nullptr));
+    int numberOfFrames = -1;
+    int numberOfCheckpointedFrames = -1;
+    bool succeed = APIExit(sqlite3_wal_checkpoint_v2(
+    m_handle, Syntax::mainSchema.data(), (int) mode, &numberOfFrames, &numberOfCheckpointedFrames));
+    if (result != nullptr) {
+        result->numberOfFrames = numberOfFrames;
+        result->numberOfCheckpointedFrames = numberOfCheckpointedFrames;
+    }
+    return succeed;
 }
 
 void AbstractHandle::disableCheckpointWhenClosing(bool disable)
@@ -688,6 +885,11 @@ void AbstractHandle::setNotificationWhenBusy(const BusyNotification &busyNotific
     m_notification.setNotificationWhenBusy(busyNotification);
 }
 
+void AbstractHandle::setBusyTimeOut(double timeOut)
+{
+    m_notification.setBusyTimeOut(timeOut);
+}
+
 void AbstractHandle::setNotificationWhenTableModified(const UnsafeStringView &name,
                                                       const TableModifiedNotification &tableModifiedNotification)
 {
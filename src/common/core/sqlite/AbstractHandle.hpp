@@ -33,8 +33,11 @@
 #include "Tag.hpp"
 #include "WCDBOptional.hpp"
 #include "WINQ.h"
+#include <list>
+#include <memory>
 #include <set>
 #include <tuple>
+#include <unordered_map>
 #include <vector>
 
 namespace WCDB {
@@ -104,13 +107,65 @@ public:
     virtual void returnStatement(HandleStatement *handleStatement);
     virtual void resetAllStatements();
     virtual void finalizeStatements();
+    // The statement returned is never evicted until all statements are finalized, since its holder can't be tracked.
     HandleStatement *getOrCreatePreparedStatement(const Statement &statement);
     HandleStatement *getOrCreatePreparedStatement(const UnsafeStringView &sql);
 
+    // Holders of a cached statement share its reference. It's never evicted while it's referenced,
+    // so that the bindings and the steps of its holders are kept, and it's released as soon as it's evicted.
+    typedef std::shared_ptr<void> PreparedStatementReference;
+    HandleStatement *getOrCreatePreparedStatement(const Statement &statement,
+                                                  PreparedStatementReference &reference);
+
+    // 0 means unlimited. Statements that are stepping or referenced will never be evicted.
+    void setPreparedStatementCacheBudget(int maxCount, size_t maxMemory);
+
+    typedef struct PreparedStatementCacheStatistics {
+        uint64_t hitCount = 0;
+        uint64_t missCount = 0;
+        uint64_t evictionCount = 0;
+    } PreparedStatementCacheStatistics;
+    const PreparedStatementCacheStatistics &getPreparedStatementCacheStatistics() const;
+
 private:
-    HandleStatement *getOrCreateStatement(const UnsafeStringView &sql);
+    struct PreparedStatementEntry {
+        PreparedStatementEntry(const UnsafeStringView &key,
+                               bool fingerprinted,
+                               DecorativeHandleStatement *handleStatement);
+        // The fingerprint of statement if fingerprinted, otherwise the sql.
+        StringView key;
+        bool fingerprinted;
+        // The origin statement to prepare it again after it's finalized by caller. Empty if it's prepared from sql.
+        Optional<Statement> statement;
+        DecorativeHandleStatement *handleStatement;
+        // Memory used when it's prepared.
+        size_t memoryUsed;
+        // Handed out without reference.
+        bool pinned;
+        PreparedStatementReference reference;
+    };
+    typedef std::list<PreparedStatementEntry> PreparedStatementList;
+    static bool isFingerprintedStatement(const Statement &statement);
+    bool checkPreparedStatementValid(bool valid);
+    PreparedStatementList::iterator getOrCreatePreparedStatementEntry(const Statement &statement);
+    PreparedStatementList::iterator
+    findPreparedStatement(const UnsafeStringView &key, bool fingerprinted);
+    PreparedStatementList::iterator
+    createPreparedStatement(const UnsafeStringView &key, bool fingerprinted);
+    bool prepareCachedStatement(PreparedStatementList::iterator entry);
+    bool isPreparedStatementCacheOverBudget() const;
+    void tryEvictPreparedStatements(const HandleStatement *newStatement);
     std::list<DecorativeHandleStatement> m_handleStatements;
-    StringViewMap<DecorativeHandleStatement *> m_preparedStatements;
+    // The most recently used statement is placed at the front.
+    PreparedStatementList m_preparedStatementList;
+    // Indexed by the hash of key, so that a lookup doesn't compare the whole key with
+    // log(n) others, and a key is only copied when it's missed.
+    typedef std::unordered_multimap<uint32_t, PreparedStatementList::iterator> PreparedStatementIndex;
+    PreparedStatementIndex m_preparedStatements;
+    int m_maxPreparedStatementCount;
+    size_t m_maxPreparedStatementMemory;
+    size_t m_preparedStatementMemory;
+    PreparedStatementCacheStatistics m_preparedStatementStatistics;
 
 #pragma mark - Meta
 public:
@@ -169,7 +224,13 @@ public:
         Restart,
         Truncate,
     };
-    bool checkpoint(CheckpointMode mode = CheckpointMode::Passive);
+    typedef struct CheckpointResult {
+        // -1 if checkpoint could not run.
+        int numberOfFrames = -1;
+        int numberOfCheckpointedFrames = -1;
+    } CheckpointResult;
+    bool checkpoint(CheckpointMode mode = CheckpointMode::Passive,
+                    CheckpointResult *result = nullptr);
     void disableCheckpointWhenClosing(bool disable);
     void setWALFilePersist(int persist);
     bool setCheckPointLock(bool enable);
@@ -197,6 +258,8 @@ public:
 
     typedef HandleNotification::BusyNotification BusyNotification;
     void setNotificationWhenBusy(const BusyNotification &busyNotification);
+    // Limit the time of waiting for busy in each of the following operations, 0 for no limit.
+    void setBusyTimeOut(double timeOut);
 
     typedef HandleNotification::TableModifiedNotification TableModifiedNotification;
     void setNotificationWhenTableModified(const UnsafeStringView &name,
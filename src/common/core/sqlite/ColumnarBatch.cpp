@@ -0,0 +1,152 @@
+//
+// Created by qiuwenchen on 2026/10/16.
+//
+
+/*
+ * Tencent is pleased to support the open source community by making
+ * WCDB available.
+ *
+ * Copyright (C) 2017 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the BSD 3-Clause License (the "License"); you may not use
+ * this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *       https://opensource.org/licenses/BSD-3-Clause
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ColumnarBatch.hpp"
+#include "Assertion.hpp"
+#include <string.h>
+
+namespace WCDB {
+
+#pragma mark - ColumnArena
+ColumnArena::ColumnArena()
+{
+    m_offsets.push_back(0);
+}
+
+void ColumnArena::clear()
+{
+    m_buffer.clear();
+    m_offsets.resize(1);
+}
+
+void ColumnArena::reserve(size_t numberOfValues, size_t numberOfBytes)
+{
+    m_offsets.reserve(numberOfValues + 1);
+    m_buffer.reserve(numberOfBytes + numberOfValues);
+}
+
+void ColumnArena::append(const unsigned char *buffer, size_t size)
+{
+    size_t offset = m_buffer.size();
+    m_buffer.resize(offset + size + 1);
+    if (size > 0) {
+        memcpy(m_buffer.data() + offset, buffer, size);
+    }
+    m_buffer[offset + size] = '\0';
+    m_offsets.push_back(m_buffer.size());
+}
+
+size_t ColumnArena::size() const
+{
+    return m_offsets.size() - 1;
+}
+
+bool ColumnArena::empty() const
+{
+    return size() == 0;
+}
+
+UnsafeStringView ColumnArena::getText(size_t index) const
+{
+    WCTAssert(index < size());
+    size_t offset = m_offsets[index];
+    return UnsafeStringView(reinterpret_cast<const char *>(m_buffer.data() + offset),
+                            m_offsets[index + 1] - offset - 1);
+}
+
+const UnsafeData ColumnArena::getBLOB(size_t index) const
+{
+    WCTAssert(index < size());
+    size_t offset = m_offsets[index];
+    return UnsafeData::immutable(m_buffer.data() + offset, m_offsets[index + 1] - offset - 1);
+}
+
+UnsafeStringView ColumnArena::operator[](size_t index) const
+{
+    return getText(index);
+}
+
+#pragma mark - ColumnarBatch
+ColumnarBatch::ColumnarBatch() : m_numberOfRows(0)
+{
+}
+
+ColumnarBatch &ColumnarBatch::integers(int index, std::vector<int64_t> &buffer)
+{
+    m_targets.push_back({ index, ColumnType::Integer, &buffer });
+    return *this;
+}
+
+ColumnarBatch &ColumnarBatch::doubles(int index, std::vector<double> &buffer)
+{
+    m_targets.push_back({ index, ColumnType::Float, &buffer });
+    return *this;
+}
+
+ColumnarBatch &ColumnarBatch::texts(int index, ColumnArena &arena)
+{
+    m_targets.push_back({ index, ColumnType::Text, &arena });
+    return *this;
+}
+
+ColumnarBatch &ColumnarBatch::blobs(int index, ColumnArena &arena)
+{
+    m_targets.push_back({ index, ColumnType::BLOB, &arena });
+    return *this;
+}
+
+size_t ColumnarBatch::getNumberOfRows() const
+{
+    return m_numberOfRows;
+}
+
+void ColumnarBatch::prepareForRows(size_t numberOfRows)
+{
+    m_numberOfRows = 0;
+    for (const Target &target : m_targets) {
+        switch (target.type) {
+        case ColumnType::Integer: {
+            auto buffer = static_cast<std::vector<int64_t> *>(target.buffer);
+            buffer->clear();
+            buffer->reserve(numberOfRows);
+        } break;
+        case ColumnType::Float: {
+            auto buffer = static_cast<std::vector<double> *>(target.buffer);
+            buffer->clear();
+            buffer->reserve(numberOfRows);
+        } break;
+        case ColumnType::Text:
+        case ColumnType::BLOB: {
+            auto arena = static_cast<ColumnArena *>(target.buffer);
+            arena->clear();
+            arena->reserve(numberOfRows, 0);
+        } break;
+        default:
+            WCTAssert(false);
+            break;
+        }
+    }
+}
+
+} //namespace WCDB
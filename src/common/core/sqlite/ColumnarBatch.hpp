@@ -0,0 +1,93 @@
+//
+// Created by qiuwenchen on 2026/10/16.
+//
+
+/*
+ * Tencent is pleased to support the open source community by making
+ * WCDB available.
+ *
+ * Copyright (C) 2017 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the BSD 3-Clause License (the "License"); you may not use
+ * this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *       https://opensource.org/licenses/BSD-3-Clause
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "ColumnType.hpp"
+#include "StringView.hpp"
+#include "UnsafeData.hpp"
+#include <vector>
+
+namespace WCDB {
+
+class HandleStatement;
+
+/**
+ @brief A contiguous buffer that stores variable-length text or BLOB values of a column.
+ Values are appended back to back with a trailing zero, so that the whole batch is held by one allocation.
+ The views returned are only valid until the arena is modified.
+ */
+class WCDB_API ColumnArena final {
+public:
+    ColumnArena();
+
+    void clear();
+    void reserve(size_t numberOfValues, size_t numberOfBytes);
+    void append(const unsigned char *buffer, size_t size);
+
+    size_t size() const;
+    bool empty() const;
+    UnsafeStringView getText(size_t index) const;
+    const UnsafeData getBLOB(size_t index) const;
+    UnsafeStringView operator[](size_t index) const;
+
+private:
+    std::vector<unsigned char> m_buffer;
+    std::vector<size_t> m_offsets;
+};
+
+/**
+ @brief Describe how the columns of a result are extracted into caller-provided buffers.
+ Buffers are cleared at the beginning of each batch, while their capacities are retained for the next batch.
+ NULL is extracted as 0 for numeric buffers and as an empty value for arenas.
+ */
+class WCDB_API ColumnarBatch final {
+    friend class HandleStatement;
+
+public:
+    ColumnarBatch();
+
+    ColumnarBatch &integers(int index, std::vector<int64_t> &buffer);
+    ColumnarBatch &doubles(int index, std::vector<double> &buffer);
+    ColumnarBatch &texts(int index, ColumnArena &arena);
+    ColumnarBatch &blobs(int index, ColumnArena &arena);
+
+    /**
+     @brief The number of rows extracted by the last batch.
+     */
+    size_t getNumberOfRows() const;
+
+protected:
+    void prepareForRows(size_t numberOfRows);
+
+    struct Target {
+        int index;
+        ColumnType type;
+        void *buffer;
+    };
+    std::vector<Target> m_targets;
+    size_t m_numberOfRows;
+};
+
+} //namespace WCDB
@@ -27,6 +27,7 @@
 #include "Assertion.hpp"
 #include "SQLite.h"
 #include "StringView.hpp"
+#include <algorithm>
 
 namespace WCDB {
 
@@ -362,12 +363,28 @@ void HandleNotification::setNotificationWhenBusy(const BusyNotification &busyNot
     }
 }
 
+void HandleNotification::setBusyTimeOut(double timeOut)
+{
+    m_busyTimeOut = std::max(timeOut, 0.0);
+}
+
 bool HandleNotification::postBusyNotification(int numberOfTimes)
 {
     WCTAssert(m_busyNotification != nullptr);
     bool retry = false;
     if (m_busyNotification != nullptr) {
-        retry = m_busyNotification(getHandle()->getPath(), numberOfTimes);
+        double timeOut = 0;
+        if (m_busyTimeOut > 0) {
+            // The number of times is reset for each operation.
+            if (numberOfTimes == 0) {
+                m_busyBeginTime = SteadyClock::now();
+            }
+            timeOut = m_busyTimeOut - SteadyClock::timeIntervalSinceSteadyClockToNow(m_busyBeginTime);
+            if (timeOut <= 0) {
+                return false;
+            }
+        }
+        retry = m_busyNotification(getHandle()->getPath(), numberOfTimes, timeOut);
     }
     return retry;
 }
@@ -28,6 +28,7 @@
 #include "Lock.hpp"
 #include "SQLiteDeclaration.h"
 #include "Tag.hpp"
+#include "Time.hpp"
 #include "UniqueList.hpp"
 #include "WCDBOptional.hpp"
 #include <functional>
@@ -151,13 +152,18 @@ private:
 
 #pragma mark - Busy
 public:
-    typedef std::function<bool(const UnsafeStringView &path, int numberOfTimes)> BusyNotification;
+    // timeOut is the seconds left to wait for, or 0 for no limit.
+    typedef std::function<bool(const UnsafeStringView &path, int numberOfTimes, double timeOut)> BusyNotification;
     void setNotificationWhenBusy(const BusyNotification &busyNotification);
+    // Limit the time of waiting for busy in each of the following operations, 0 for no limit.
+    void setBusyTimeOut(double timeOut);
 
 private:
     static int onBusy(void *p, int numberOfTimes);
     bool postBusyNotification(int numberOfTimes);
     BusyNotification m_busyNotification;
+    double m_busyTimeOut = 0;
+    SteadyClock m_busyBeginTime;
 
 #pragma mark - Table Modification
 public:
@@ -26,6 +26,7 @@
 #include "AbstractHandle.hpp"
 #include "Assertion.hpp"
 #include "BaseBinding.hpp"
+#include "ColumnarBatch.hpp"
 #include "CommonCore.hpp"
 #include "CompressingHandleDecorator.hpp"
 #include "CompressionConst.hpp"
@@ -750,6 +751,53 @@ OptionalMultiRows HandleStatement::getAllRows()
     return !result.hasValue() ? MultiRowsValue() : result;
 }
 
+bool HandleStatement::fetchBatch(ColumnarBatch &batch, size_t maxNumberOfRows)
+{
+    WCTAssert(isPrepared());
+    batch.prepareForRows(maxNumberOfRows);
+    // Step again after done will restart the statement.
+    if (m_done) {
+        return true;
+    }
+    while (batch.m_numberOfRows < maxNumberOfRows) {
+        if (!step()) {
+            return false;
+        }
+        if (m_done) {
+            break;
+        }
+        for (const ColumnarBatch::Target &target : batch.m_targets) {
+            switch (target.type) {
+            case ColumnType::Integer:
+                static_cast<std::vector<int64_t> *>(target.buffer)
+                ->push_back(sqlite3_column_int64(m_stmt, target.index));
+                break;
+            case ColumnType::Float:
+                static_cast<std::vector<double> *>(target.buffer)
+                ->push_back(sqlite3_column_double(m_stmt, target.index));
+                break;
+            case ColumnType::Text: {
+                // sqlite3_column_bytes must be called after sqlite3_column_text to get the size of converted text.
+                const unsigned char *text = sqlite3_column_text(m_stmt, target.index);
+                static_cast<ColumnArena *>(target.buffer)
+                ->append(text, sqlite3_column_bytes(m_stmt, target.index));
+            } break;
+            case ColumnType::BLOB: {
+                const void *blob = sqlite3_column_blob(m_stmt, target.index);
+                static_cast<ColumnArena *>(target.buffer)
+                ->append(static_cast<const unsigned char *>(blob),
+                         sqlite3_column_bytes(m_stmt, target.index));
+            } break;
+            default:
+                WCTAssert(false);
+                break;
+            }
+        }
+        ++batch.m_numberOfRows;
+    }
+    return true;
+}
+
 signed long long HandleStatement::getColumnSize(int index)
 {
     WCTAssert(isPrepared());
@@ -763,6 +811,12 @@ bool HandleStatement::isBusy()
     return sqlite3_stmt_busy(m_stmt) != 0;
 }
 
+int HandleStatement::getMemoryUsed()
+{
+    WCTAssert(isPrepared());
+    return sqlite3_stmt_status(m_stmt, SQLITE_STMTSTATUS_MEMUSED, 0);
+}
+
 void HandleStatement::enableAutoAddColumn()
 {
     m_needAutoAddColumn = true;
@@ -33,6 +33,7 @@
 namespace WCDB {
 
 class HandleStatementDecorator;
+class ColumnarBatch;
 
 class HandleStatement : public HandleRelated {
     friend class AbstractHandle;
@@ -93,6 +94,7 @@ public:
     OptionalOneColumn getOneColumn(int index = 0);
     OneRowValue getOneRow();
     OptionalMultiRows getAllRows();
+    bool fetchBatch(ColumnarBatch &batch, size_t maxNumberOfRows);
 
     const UnsafeStringView getOriginColumnName(int index);
     const UnsafeStringView getColumnName(int index);
@@ -104,6 +106,7 @@ public:
 
 protected:
     bool isBusy();
+    int getMemoryUsed();
 
 private:
     void analysisStatement(const Statement &statement);
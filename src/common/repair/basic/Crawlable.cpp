@@ -25,10 +25,14 @@
 #include "Crawlable.hpp"
 #include "Assertion.hpp"
 #include "Cell.hpp"
+#include "CoreConst.h"
 #include "Page.hpp"
+#include "PagePrefetcher.hpp"
 #include "Pager.hpp"
 #include "StringView.hpp"
 #include "ThreadedErrors.hpp"
+#include <algorithm>
+#include <thread>
 
 namespace WCDB {
 
@@ -36,7 +40,10 @@ namespace Repair {
 
 #pragma mark - Initialize
 Crawlable::Crawlable()
-: m_associatedPager(nullptr), m_suspend(false), m_isCrawling(false)
+: m_associatedPager(nullptr)
+, m_suspend(false)
+, m_isCrawling(false)
+, m_parallelCrawling(false)
 {
 }
 
@@ -82,12 +89,19 @@ bool Crawlable::crawl(int rootpageno)
     m_isCrawling = true;
     std::set<int> crawledInteriorPages;
     safeCrawl(rootpageno, crawledInteriorPages, 1);
+    if (m_prefetcher != nullptr) {
+        m_prefetcher->stop();
+        m_prefetcher = nullptr;
+    }
     m_isCrawling = false;
     return m_associatedPager->getError().isOK();
 }
 
 void Crawlable::safeCrawl(int rootpageno, std::set<int> &crawledInteriorPages, int height)
 {
+    if (m_prefetcher != nullptr) {
+        m_prefetcher->consume(rootpageno);
+    }
     if (m_suspend || !canCrawlPage(rootpageno)) {
         return;
     }
@@ -114,6 +128,7 @@ void Crawlable::safeCrawl(int rootpageno, std::set<int> &crawledInteriorPages, i
     crawledInteriorPages.emplace(rootpageno);
     switch (rootpage.getType()) {
     case Page::Type::InteriorTable:
+        prefetchSubpages(rootpage);
         for (int i = 0; i < rootpage.getNumberOfSubpages(); ++i) {
             if (m_suspend) {
                 return;
@@ -158,6 +173,48 @@ void Crawlable::safeCrawl(int rootpageno, std::set<int> &crawledInteriorPages, i
     }
 }
 
+#pragma mark - Parallel
+void Crawlable::enableParallelCrawling(bool enable)
+{
+    WCTAssert(!m_isCrawling);
+    m_parallelCrawling = enable;
+}
+
+std::atomic<bool> &Crawlable::parallelCrawlingAllowed()
+{
+    static std::atomic<bool> *g_allowed = new std::atomic<bool>(true);
+    return *g_allowed;
+}
+
+void Crawlable::allowParallelCrawling(bool allow)
+{
+    parallelCrawlingAllowed().store(allow);
+}
+
+void Crawlable::prefetchSubpages(const Page &page)
+{
+    if (!m_parallelCrawling || !parallelCrawlingAllowed().load()) {
+        return;
+    }
+    if (m_prefetcher == nullptr) {
+        // The crawling thread itself is busy with assembling cells.
+        int numberOfWorkers = std::min<int>(RepairMaxNumberOfWorkers,
+                                            (int) std::thread::hardware_concurrency())
+                              - 1;
+        if (numberOfWorkers <= 0
+            || page.getNumberOfSubpages() < RepairMinNumberOfPagesToPrefetch) {
+            return;
+        }
+        m_prefetcher = std::make_shared<PagePrefetcher>(m_associatedPager, numberOfWorkers);
+    }
+    std::vector<int> subpagenos;
+    subpagenos.reserve(page.getNumberOfSubpages());
+    for (int i = 0; i < page.getNumberOfSubpages(); ++i) {
+        subpagenos.push_back(page.getSubpageno(i));
+    }
+    m_prefetcher->schedule(subpagenos);
+}
+
 void Crawlable::onCellCrawled(const Cell &cell)
 {
     WCDB_UNUSED(cell);
@@ -25,6 +25,7 @@
 #pragma once
 
 #include "Pager.hpp"
+#include <memory>
 #include <set>
 
 namespace WCDB {
@@ -34,6 +35,7 @@ namespace Repair {
 class Cell;
 class Page;
 class Pager;
+class PagePrefetcher;
 
 class Crawlable {
 #pragma mark - Initialize
@@ -76,6 +78,19 @@ private:
     void safeCrawl(int rootpageno, std::set<int> &crawledInteriorPages, int height);
     bool m_isCrawling;
     bool m_isCrawlingIndexTable;
+
+#pragma mark - Parallel
+public:
+    // The pages are loaded by workers ahead of crawling, while the cells are still delivered in order by the crawling thread.
+    void enableParallelCrawling(bool enable);
+    // Parallel crawling is allowed by default. It can be disallowed for all crawlers, e.g. to compare with serial crawling.
+    static void allowParallelCrawling(bool allow); // thread-safe
+
+private:
+    void prefetchSubpages(const Page &page);
+    static std::atomic<bool> &parallelCrawlingAllowed();
+    bool m_parallelCrawling;
+    std::shared_ptr<PagePrefetcher> m_prefetcher;
 };
 
 } //namespace Repair
@@ -62,6 +62,11 @@ int Repairman::getDisposedWalPageCount() const
     return m_pager.getDisposedWalPages();
 }
 
+Pager::Statistics Repairman::getPageStatistics() const
+{
+    return m_pager.getStatistics();
+}
+
 bool Repairman::exit()
 {
     if (!isErrorCritial()) {
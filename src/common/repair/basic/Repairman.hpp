@@ -52,6 +52,7 @@ public:
     const StringView &getPath() const;
     int64_t getTotalPageCount() const;
     int getDisposedWalPageCount() const;
+    Pager::Statistics getPageStatistics() const;
 
 protected:
     Optional<bool> isEmptyDatabase();
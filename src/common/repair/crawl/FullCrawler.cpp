@@ -42,6 +42,8 @@ FullCrawler::FullCrawler(const UnsafeStringView &source)
 {
     m_sequenceCrawler.setAssociatedPager(&m_pager);
     m_masterCrawler.setAssociatedPager(&m_pager);
+    m_pager.setPageSource(Pager::PageSource::Read);
+    enableParallelCrawling(true);
 }
 
 FullCrawler::~FullCrawler() = default;
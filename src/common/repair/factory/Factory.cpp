@@ -203,6 +203,11 @@ StringView Factory::lastMaterialPathForDatabase(const UnsafeStringView &database
     return Path::addExtention(database, "-last.material");
 }
 
+StringView Factory::materialLogPathForDatabase(const UnsafeStringView &database)
+{
+    return Path::addExtention(database, "-log.material");
+}
+
 StringView Factory::factoryPathForDatabase(const UnsafeStringView &database)
 {
     return Path::addExtention(database, ".factory");
@@ -238,6 +243,7 @@ std::list<StringView> Factory::associatedPathsForDatabase(const UnsafeStringView
         incrementalMaterialPathForDatabase(database),
         firstMaterialPathForDatabase(database),
         lastMaterialPathForDatabase(database),
+        materialLogPathForDatabase(database),
     };
 }
 
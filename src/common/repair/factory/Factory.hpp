@@ -88,6 +88,7 @@ public:
     static StringView incrementalMaterialPathForDatabase(const UnsafeStringView &database);
     static StringView firstMaterialPathForDatabase(const UnsafeStringView &database);
     static StringView lastMaterialPathForDatabase(const UnsafeStringView &database);
+    static StringView materialLogPathForDatabase(const UnsafeStringView &database);
     static StringView factoryPathForDatabase(const UnsafeStringView &database);
 
     static Optional<StringView>
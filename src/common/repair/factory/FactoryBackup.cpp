@@ -28,6 +28,7 @@
 #include "Data.hpp"
 #include "Factory.hpp"
 #include "FileManager.hpp"
+#include "MaterialLog.hpp"
 #include "Notifier.hpp"
 
 namespace WCDB {
@@ -89,7 +90,7 @@ bool FactoryBackup::doBackUp(const UnsafeStringView& database, bool interruptibl
     if (!backup.work(incrementalMaterial)) {
         // Treat database empty error as succeed
         if (backup.getError().code() == Error::Code::Empty) {
-            notifiyBackupEnd(database, 0, 0, backup.getMaterial(), incrementalMaterial);
+            notifiyBackupEnd(database, 0, false, 0, backup.getMaterial(), incrementalMaterial);
             return true;
         }
         setError(backup.getError());
@@ -97,9 +98,17 @@ bool FactoryBackup::doBackUp(const UnsafeStringView& database, bool interruptibl
     }
 
     const Material& material = backup.getMaterial();
-    auto materialSize = saveMaterial(database, material);
-    if (!materialSize.hasValue()) {
-        return false;
+    Optional<size_t> materialSize;
+    if (backup.isMaterialLogAppendable()) {
+        materialSize = appendMaterialLog(database, backup);
+    }
+    bool materialLogged = materialSize.hasValue();
+    if (!materialLogged) {
+        // Compact the material log into a full material.
+        materialSize = saveMaterial(database, material);
+        if (!materialSize.hasValue()) {
+            return false;
+        }
     }
 
     SharedIncrementalMaterial newIncrementalMaterial = backup.getIncrementalMaterial();
@@ -111,8 +120,12 @@ bool FactoryBackup::doBackUp(const UnsafeStringView& database, bool interruptibl
     }
 
     if (interruptible) {
-        notifiyBackupEnd(
-        database, materialSize.value(), incrementalMaterialSize.value(), material, newIncrementalMaterial);
+        notifiyBackupEnd(database,
+                         materialSize.value(),
+                         materialLogged,
+                         incrementalMaterialSize.value(),
+                         material,
+                         newIncrementalMaterial);
     }
     return true;
 }
@@ -160,9 +173,50 @@ FactoryBackup::saveMaterial(const UnsafeStringView& database, const Material& ma
             return NullOpt;
         }
     }
+    // The log is based on the previous material, so it is removed only after the new material is saved.
+    // If it's interrupted in between, the stale log is ignored since it doesn't match the new material.
+    MaterialLog materialLog(Factory::materialLogPathForDatabase(database));
+    if (!materialLog.reset()) {
+        assignWithSharedThreadedError();
+        return NullOpt;
+    }
     return FileManager::getFileSize(materialPath.value());
 }
 
+Optional<size_t>
+FactoryBackup::appendMaterialLog(const UnsafeStringView& database, const Backup& backup)
+{
+    auto baseMaterialPath = Factory::latestMaterialForDatabase(database);
+    if (!baseMaterialPath.succeed() || baseMaterialPath->empty()) {
+        return NullOpt;
+    }
+    auto baseSize = FileManager::getFileSize(baseMaterialPath.value());
+    StringView materialLogPath = Factory::materialLogPathForDatabase(database);
+    auto logSize = FileManager::getFileSize(materialLogPath);
+    if (!baseSize.succeed() || !logSize.succeed()) {
+        return NullOpt;
+    }
+    // Compact it when the log is large enough comparing to the material.
+    if (logSize.value() * 100 >= baseSize.value() * BackupMaxMaterialLogSizePercentage) {
+        return NullOpt;
+    }
+
+    MaterialLog materialLog(materialLogPath);
+    if (m_cipherDelegate->isCipherDB()) {
+        materialLog.setCipherDelegate(m_cipherDelegate);
+    }
+    if (!materialLog.append(
+        backup.getBaseChecksum(), backup.getBaseContents(), backup.getMaterial())) {
+        // A torn block may be left, and it will be dropped by the compaction.
+        return NullOpt;
+    }
+    auto newLogSize = FileManager::getFileSize(materialLogPath);
+    if (!newLogSize.succeed()) {
+        return NullOpt;
+    }
+    return newLogSize.value() - logSize.value();
+}
+
 void FactoryBackup::notifiyBackupBegin(const UnsafeStringView& database)
 {
     Error error(Error::Code::Notice, Error::Level::Notice, "Backup Begin.");
@@ -172,6 +226,7 @@ void FactoryBackup::notifiyBackupBegin(const UnsafeStringView& database)
 
 void FactoryBackup::notifiyBackupEnd(const UnsafeStringView& database,
                                      size_t materialSize,
+                                     bool materialLogged,
                                      size_t incrementalMaterialSize,
                                      const Material& material,
                                      SharedIncrementalMaterial incrementalMaterial)
@@ -187,6 +242,7 @@ void FactoryBackup::notifiyBackupEnd(const UnsafeStringView& database,
                                  incrementalMaterial != nullptr
                                  && incrementalMaterial->info.incrementalBackupTimes > 0);
     error.infos.insert_or_assign("MaterialSize", materialSize);
+    error.infos.insert_or_assign("MaterialLogged", materialLogged);
     error.infos.insert_or_assign("LastIncrementalMaterialSize", incrementalMaterialSize);
     error.infos.insert_or_assign("TableCount", material.contentsMap.size());
     error.infos.insert_or_assign("AssociatedTableCount", associatedTableCount);
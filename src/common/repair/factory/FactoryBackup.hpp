@@ -47,9 +47,11 @@ protected:
                                              SharedIncrementalMaterial material);
     Optional<size_t>
     saveMaterial(const UnsafeStringView& database, const Material& material);
+    Optional<size_t> appendMaterialLog(const UnsafeStringView& database, const Backup& backup);
     void notifiyBackupBegin(const UnsafeStringView& database);
     void notifiyBackupEnd(const UnsafeStringView& database,
                           size_t materialSize,
+                          bool materialLogged,
                           size_t incrementalMaterialSize,
                           const Material& material,
                           SharedIncrementalMaterial incrementalMaterial);
@@ -28,6 +28,7 @@
 #include "Factory.hpp"
 #include "FactoryBackup.hpp"
 #include "FileManager.hpp"
+#include "MaterialLog.hpp"
 #include "Notifier.hpp"
 #include "Path.hpp"
 
@@ -235,6 +236,11 @@ bool FactoryRenewer::resolveInfosForDatabase(StringViewMap<Info> &infos,
                 break;
             }
         }
+        MaterialLog materialLog(Factory::materialLogPathForDatabase(databaseForAcquisition));
+        if (m_cipherDelegate->isCipherDB()) {
+            materialLog.setCipherDelegate(m_cipherDelegate);
+        }
+        materialLog.replay(material);
 
         for (auto &element : material.contentsMap) {
             auto iter = infos.find(element.first);
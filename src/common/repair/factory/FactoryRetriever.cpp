@@ -31,6 +31,7 @@
 #include "FileHandle.hpp"
 #include "FileManager.hpp"
 #include "FullCrawler.hpp"
+#include "MaterialLog.hpp"
 #include "Mechanic.hpp"
 #include "Notifier.hpp"
 #include "Path.hpp"
@@ -190,6 +191,13 @@ bool FactoryRetriever::restore(const UnsafeStringView &databasePath)
             }
 
             if (useMaterial) {
+                // Blocks of the log are applied only if it's based on this material.
+                MaterialLog materialLog(Factory::materialLogPathForDatabase(databasePath));
+                if (m_cipherDelegate->isCipherDB()) {
+                    materialLog.setCipherDelegate(m_cipherDelegate);
+                }
+                materialLog.replay(material);
+
                 auto optionalMaterialTime = FileManager::getFileModifiedTime(materialPath);
                 if (!optionalMaterialTime.succeed()) {
                     setCriticalErrorWithSharedThreadedError();
@@ -291,6 +299,7 @@ void FactoryRetriever::reportMechanic(const Mechanic &mechanic,
         error.infos.insert_or_assign("Material", optionalMaterial.value());
     }
     finishReportOfPerformance(error, path, cost);
+    finishReportOfPageStatistics(error, mechanic);
     error.infos.insert_or_assign(
     "Weight", StringView::formatted("%f%%", getWeight(path).value() * 100.0f));
     Notifier::shared().notify(error);
@@ -307,6 +316,7 @@ void FactoryRetriever::reportFullCrawler(const FullCrawler &fullCrawler,
     error.infos.insert_or_assign("Score", fullCrawler.getScore().value());
     error.infos.insert_or_assign("TotalPageCount", fullCrawler.getTotalPageCount());
     finishReportOfPerformance(error, path, cost);
+    finishReportOfPageStatistics(error, fullCrawler);
     error.infos.insert_or_assign(
     "Weight", StringView::formatted("%f%%", getWeight(path).value() * 100.0f));
     Notifier::shared().notify(error);
@@ -335,6 +345,15 @@ void FactoryRetriever::finishReportOfPerformance(Error &error,
     error.infos.insert_or_assign("Speed", StringView::formatted("%f MB/s", speed));
 }
 
+void FactoryRetriever::finishReportOfPageStatistics(Error &error, const Repairman &repairman)
+{
+    Pager::Statistics statistics = repairman.getPageStatistics();
+    error.infos.insert_or_assign(
+    "PageCacheHitRate", StringView::formatted("%f%%", statistics.getCacheHitRate() * 100.0f));
+    error.infos.insert_or_assign(
+    "ReadAmplification", StringView::formatted("%f", statistics.getReadAmplification()));
+}
+
 #pragma mark - Score and Progress
 bool FactoryRetriever::calculateSizes(const std::list<StringView> &workshopDirectories)
 {
@@ -39,6 +39,7 @@ namespace Repair {
 
 class Mechanic;
 class FullCrawler;
+class Repairman;
 
 class FactoryRetriever final : public FactoryRelated,
                                public UpgradeableErrorProne,
@@ -74,6 +75,7 @@ protected:
     void reportSummary(double cost);
 
     void finishReportOfPerformance(Error &error, const UnsafeStringView &database, double cost);
+    void finishReportOfPageStatistics(Error &error, const Repairman &repairman);
 
 #pragma mark - Evaluation and Progress
 protected:
@@ -29,6 +29,7 @@
 #include "Factory.hpp"
 #include "FileManager.hpp"
 #include "MasterItem.hpp"
+#include "MaterialLog.hpp"
 #include "Notifier.hpp"
 #include "Page.hpp"
 #include "SequenceItem.hpp"
@@ -78,6 +79,8 @@ Backup::Backup(const UnsafeStringView &path)
 , m_incrementalMaterial(nullptr)
 , m_verifyingPagenos(nullptr)
 , m_unchangedLeavesCount(0)
+, m_materialLogAppendable(false)
+, m_baseChecksum(0)
 , m_masterCrawler()
 {
     setAssociatedPager(&m_pager);
@@ -144,6 +147,12 @@ Optional<bool> Backup::tryLoadLatestMaterial(SharedIncrementalMaterial increment
         m_material = Material();
         return NullOpt;
     }
+    if (!replayMaterialLog()) {
+        // The changes in the broken blocks are missing from material, so it can't be the base of incremental backup.
+        // A full backup is done instead, which compacts the log as well.
+        m_material = Material();
+        return false;
+    }
     if (m_material.info.walSalt != incrementalMaterial->info.lastWalSalt
         || m_material.info.nBackFill != incrementalMaterial->info.lastNBackFill) {
         Error error(Error::Code::Error, Error::Level::Warning, "Mismatch incremental Material");
@@ -162,6 +171,9 @@ Optional<bool> Backup::tryLoadLatestMaterial(SharedIncrementalMaterial increment
         m_material = Material();
         return false;
     }
+    m_materialLogAppendable = true;
+    m_baseChecksum = m_material.getContentsChecksum();
+    m_baseContents = m_material.contentsList;
     return true;
 }
 
@@ -188,6 +200,7 @@ bool Backup::fullBackup()
             m_pager.setPageSize((int) pageSize);
         }
 
+        m_pager.setPageSource(Pager::PageSource::Read);
         if (!m_pager.initialize()) {
             setError(m_pager.getError());
             break;
@@ -200,6 +213,8 @@ bool Backup::fullBackup()
         exclusive = false;
 
         m_material.setCipherDelegate(m_cipherDelegate);
+        // Incremental backup skips most of the pages so that it is not worth prefetching.
+        enableParallelCrawling(true);
         succeed = m_masterCrawler.work(this);
         if (!succeed) {
             setError(m_pager.getError());
@@ -417,6 +432,31 @@ Material::Content &Backup::getOrCreateContent(const UnsafeStringView &tableName)
     return (*iter->second);
 }
 
+#pragma mark - Material Log
+bool Backup::replayMaterialLog()
+{
+    MaterialLog materialLog(Factory::materialLogPathForDatabase(m_pager.getPath()));
+    if (m_cipherDelegate->isCipherDB()) {
+        materialLog.setCipherDelegate(m_cipherDelegate);
+    }
+    return materialLog.replay(m_material);
+}
+
+bool Backup::isMaterialLogAppendable() const
+{
+    return m_materialLogAppendable;
+}
+
+uint32_t Backup::getBaseChecksum() const
+{
+    return m_baseChecksum;
+}
+
+const std::list<Material::Content> &Backup::getBaseContents() const
+{
+    return m_baseContents;
+}
+
 #pragma mark - Filter
 void Backup::filter(const Filter &tableShouldBeBackedUp)
 {
@@ -120,6 +120,21 @@ protected:
     std::vector<bool> m_unchangedLeaves;
     int m_unchangedLeavesCount;
 
+#pragma mark - Material Log
+public:
+    // Whether the changes of this backup can be appended to the material log instead of saving a full material.
+    bool isMaterialLogAppendable() const;
+    // Checksum and contents of the material that is loaded, from which the changes are appended.
+    uint32_t getBaseChecksum() const;
+    const std::list<Material::Content> &getBaseContents() const;
+
+protected:
+    bool replayMaterialLog();
+
+    bool m_materialLogAppendable;
+    uint32_t m_baseChecksum;
+    std::list<Material::Content> m_baseContents;
+
 #pragma mark - Filter
 public:
     typedef std::function<bool(const UnsafeStringView &table)> Filter;
@@ -32,6 +32,7 @@
 #include "SQLite.h"
 #include "Serialization.hpp"
 #include "WCDBError.hpp"
+#include <algorithm>
 #include <cstring>
 
 namespace WCDB {
@@ -56,15 +57,25 @@ bool IncrementalMaterial::serialize(Serialization &serialization) const
     }
 
     //Contents
-    Serialization encoder;
+    std::vector<const Page *> sortedPages;
+    sortedPages.reserve(pages.size());
     for (const auto &element : pages) {
         if (element.second.number == 0) {
             markAsEmpty("Page");
             return false;
         }
-        if (!element.second.serialize(encoder)) {
+        sortedPages.push_back(&element.second);
+    }
+    std::sort(sortedPages.begin(), sortedPages.end(), [](const Page *a, const Page *b) {
+        return a->number < b->number;
+    });
+    Serialization encoder;
+    uint32_t prePageNo = 0;
+    for (const Page *page : sortedPages) {
+        if (!page->serialize(encoder, prePageNo)) {
             return false;
         }
+        prePageNo = page->number;
     }
     return serializeData(serialization, encoder.finalize());
 }
@@ -98,7 +109,7 @@ bool IncrementalMaterial::deserialize(Deserialization &deserialization)
         markAsCorrupt("Magic");
         return false;
     }
-    if (versionValue != 0x01000000) {
+    if (versionValue != 0x01000000 && versionValue != version) {
         markAsCorrupt("Version");
         return false;
     }
@@ -116,11 +127,13 @@ bool IncrementalMaterial::deserialize(Deserialization &deserialization)
 
     Deserialization decoder(decompressed.value());
     decoder.setDataVersion(deserialization.version());
+    uint32_t prePageNo = 0;
     while (!decoder.ended()) {
         Page page;
-        if (!page.deserialize(decoder)) {
+        if (!page.deserialize(decoder, prePageNo)) {
             return false;
         }
+        prePageNo = page.number;
         pages[page.number] = std::move(page);
     }
     return true;
@@ -268,7 +281,13 @@ IncrementalMaterial::Page::~Page() = default;
 #pragma mark - Serialization
 bool IncrementalMaterial::Page::serialize(Serialization &serialization) const
 {
-    if (!serialization.putVarint(number)) {
+    return serialize(serialization, 0);
+}
+
+bool IncrementalMaterial::Page::serialize(Serialization &serialization, uint32_t prePageNo) const
+{
+    WCTAssert(number > prePageNo);
+    if (!serialization.putVarint(number - prePageNo)) {
         return false;
     }
     if (hash != 0) {
@@ -280,13 +299,22 @@ bool IncrementalMaterial::Page::serialize(Serialization &serialization) const
 
 #pragma mark - Deserialization
 bool IncrementalMaterial::Page::deserialize(Deserialization &deserialization)
+{
+    return deserialize(deserialization, 0);
+}
+
+bool IncrementalMaterial::Page::deserialize(Deserialization &deserialization, uint32_t prePageNo)
 {
     auto varPageNo = deserialization.advanceVarint();
     if (varPageNo.first == 0) {
         markAsCorrupt("PageNo");
         return false;
     }
-    number = (uint32_t) varPageNo.second;
+    if (deserialization.version() >= 0x01000001) {
+        number = (uint32_t) (varPageNo.second + prePageNo);
+    } else {
+        number = (uint32_t) varPageNo.second;
+    }
 
     auto varType = deserialization.advanceVarint();
     if (varType.first == 0) {
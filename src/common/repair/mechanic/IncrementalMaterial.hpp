@@ -67,7 +67,7 @@ protected:
 #pragma mark - Header
 protected:
     static constexpr const uint32_t magic = 0x57434441;
-    static constexpr const uint32_t version = 0x01000000; //1.0.0.0
+    static constexpr const uint32_t version = 0x01000001; //1.0.0.1
     static constexpr const int headerSize = sizeof(magic) + sizeof(version); //magic + version
 
 #pragma mark - Info
@@ -111,9 +111,12 @@ public:
 #pragma mark - Serializable
     public:
         bool serialize(Serialization &serialization) const override final;
+        // The page number is stored as the delta from the previous page since 1.0.0.1.
+        bool serialize(Serialization &serialization, uint32_t prePageNo) const;
 #pragma mark - Deserializable
     public:
         bool deserialize(Deserialization &deserialization) override final;
+        bool deserialize(Deserialization &deserialization, uint32_t prePageNo);
     };
 
     typedef std::unordered_map<uint32_t, Page> Pages;
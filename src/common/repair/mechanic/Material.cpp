@@ -73,9 +73,10 @@ bool Material::serialize(Serialization &serialization) const
     return serializeData(serialization, encoder.finalize());
 }
 
-bool Material::serializeData(Serialization &serialization, const Data &data)
+bool Material::serializeData(Serialization &serialization, const Data &data) const
 {
     uint32_t checksum = data.empty() ? 0 : data.hash();
+    m_contentsChecksum = checksum;
     return serialization.put4BytesUInt(checksum) && serialization.putSizedData(data);
 }
 
@@ -155,6 +156,7 @@ Optional<Data> Material::deserializeData(Deserialization &deserialization)
         markAsCorrupt("Checksum");
         return NullOpt;
     }
+    m_contentsChecksum = checksum;
     return data;
 }
 
@@ -177,6 +179,12 @@ CipherDelegate *Material::getCipherDelegate() const
     return m_cipherDelegate;
 }
 
+#pragma mark - Checksum
+uint32_t Material::getContentsChecksum() const
+{
+    return m_contentsChecksum;
+}
+
 #pragma mark - Info
 Material::Info::Info()
 : pageSize(0), reservedBytes(0), walSalt({ 0, 0 }), nBackFill(0), seqTableRootPage(UnknownPageNo)
@@ -51,7 +51,7 @@ public:
     ~Material() override;
 
 protected:
-    static bool serializeData(Serialization &serialization, const Data &data);
+    bool serializeData(Serialization &serialization, const Data &data) const;
     static void markAsEmpty(const UnsafeStringView &element);
 
 #pragma mark - Deserializable
@@ -60,7 +60,7 @@ public:
     using Deserializable::deserialize;
 
 protected:
-    static Optional<Data> deserializeData(Deserialization &deserialization);
+    Optional<Data> deserializeData(Deserialization &deserialization);
     static void markAsCorrupt(const UnsafeStringView &element);
     void decryptFail(const UnsafeStringView &element) const override final;
     CipherDelegate *getCipherDelegate() const override;
@@ -129,6 +129,15 @@ public:
 
     std::list<Content> contentsList;
     StringViewMap<Content *> contentsMap;
+
+#pragma mark - Checksum
+public:
+    // Checksum of the contents that are serialized or deserialized lastly.
+    // It identifies the material which the material log is based on.
+    uint32_t getContentsChecksum() const;
+
+protected:
+    mutable uint32_t m_contentsChecksum = 0;
 };
 
 } //namespace Repair
@@ -0,0 +1,564 @@
+//
+// Created by qiuwenchen on 2026/10/16.
+//
+
+/*
+ * Tencent is pleased to support the open source community by making
+ * WCDB available.
+ *
+ * Copyright (C) 2017 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the BSD 3-Clause License (the "License"); you may not use
+ * this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *       https://opensource.org/licenses/BSD-3-Clause
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MaterialLog.hpp"
+#include "Assertion.hpp"
+#include "CoreConst.h"
+#include "Data.hpp"
+#include "FileHandle.hpp"
+#include "FileManager.hpp"
+#include "Notifier.hpp"
+#include "Serialization.hpp"
+#include "WCDBError.hpp"
+#include <algorithm>
+
+namespace WCDB {
+
+namespace Repair {
+
+#pragma mark - Initialize
+MaterialLog::MaterialLog(const UnsafeStringView &path) : m_path(path)
+{
+}
+
+MaterialLog::~MaterialLog() = default;
+
+const StringView &MaterialLog::getPath() const
+{
+    return m_path;
+}
+
+#pragma mark - Header
+void MaterialLog::markAsCorrupt(const UnsafeStringView &element)
+{
+    Error error(Error::Code::Corrupt, Error::Level::Notice, "Material log is corrupted");
+    error.infos.insert_or_assign(ErrorStringKeySource, ErrorSourceRepair);
+    error.infos.insert_or_assign("Element", element);
+    Notifier::shared().notify(error);
+    setThreadedError(std::move(error));
+}
+
+void MaterialLog::markAsEmpty(const UnsafeStringView &element)
+{
+    Error error(Error::Code::Empty, Error::Level::Error, "Element of material log is empty.");
+    error.infos.insert_or_assign(ErrorStringKeySource, ErrorSourceRepair);
+    error.infos.insert_or_assign("Element", element);
+    Notifier::shared().notify(error);
+    setThreadedError(std::move(error));
+}
+
+#pragma mark - Append
+bool MaterialLog::append(uint32_t baseChecksum,
+                         const std::list<Material::Content> &baseContents,
+                         const Material &material)
+{
+    Block block;
+    block.info = material.info;
+    block.diff(baseContents, material);
+
+    Data payload;
+    if (m_cipherDelegate != nullptr && m_cipherDelegate->isCipherDB()) {
+        block.setCipherDelegate(m_cipherDelegate);
+        payload = block.encryptedSerialize();
+    } else {
+        payload = block.serialize();
+    }
+    if (payload.empty()) {
+        return false;
+    }
+
+    auto exists = FileManager::fileExists(m_path);
+    if (!exists.succeed()) {
+        return false;
+    }
+    Serialization serialization;
+    if (!exists.value()) {
+        if (!serialization.expand(headerSize)) {
+            return false;
+        }
+        serialization.put4BytesUInt(magic);
+        serialization.put4BytesUInt(version);
+        serialization.put4BytesUInt(baseChecksum);
+    }
+    if (!serialization.putSizedData(payload)) {
+        return false;
+    }
+    Data data = serialization.finalize();
+    if (data.empty()) {
+        return false;
+    }
+
+    FileHandle fileHandle(m_path);
+    if (!fileHandle.open(FileHandle::Mode::Append)) {
+        return false;
+    }
+    bool succeed = fileHandle.write(data);
+    fileHandle.close();
+    if (!exists.value()) {
+        FileManager::setFileProtectionCompleteUntilFirstUserAuthenticationIfNeeded(m_path);
+    }
+    return succeed;
+}
+
+bool MaterialLog::reset()
+{
+    return FileManager::removeItem(m_path);
+}
+
+#pragma mark - Replay
+bool MaterialLog::replay(Material &material)
+{
+    auto exists = FileManager::fileExists(m_path);
+    if (!exists.succeed()) {
+        return false;
+    }
+    if (!exists.value()) {
+        return true;
+    }
+
+    FileHandle fileHandle(m_path);
+    if (!fileHandle.open(FileHandle::Mode::ReadOnly)) {
+        return false;
+    }
+    ssize_t fileSize = fileHandle.size();
+    if (fileSize < 0) {
+        return false;
+    }
+    if (fileSize < headerSize) {
+        markAsCorrupt("Header");
+        return false;
+    }
+
+    Data header = fileHandle.read(0, headerSize);
+    if (header.size() != headerSize) {
+        return false;
+    }
+    Deserialization deserialization(header);
+    uint32_t magicValue = deserialization.advance4BytesUInt();
+    uint32_t versionValue = deserialization.advance4BytesUInt();
+    uint32_t baseChecksum = deserialization.advance4BytesUInt();
+    if (magicValue != magic) {
+        markAsCorrupt("Magic");
+        return false;
+    }
+    if (versionValue != version) {
+        markAsCorrupt("Version");
+        return false;
+    }
+    if (baseChecksum != material.getContentsChecksum()) {
+        // The log is based on another material.
+        return false;
+    }
+
+    // Blocks are read one by one so that the whole log is never loaded into memory.
+    offset_t offset = headerSize;
+    while (offset < fileSize) {
+        // 9 is the max length of varint
+        size_t lengthOfSize = (size_t) std::min<offset_t>(fileSize - offset, 9);
+        Data sizeData = fileHandle.read(offset, lengthOfSize);
+        if (sizeData.size() != lengthOfSize) {
+            return false;
+        }
+        auto blockSize = Deserialization(sizeData).advanceVarint();
+        if (blockSize.first == 0 || blockSize.second == 0
+            || blockSize.second > (uint64_t) (fileSize - offset - blockSize.first)) {
+            // Torn tail
+            markAsCorrupt("BlockSize");
+            return false;
+        }
+        offset += blockSize.first;
+        Data blockData = fileHandle.read(offset, (size_t) blockSize.second);
+        if (blockData.size() != blockSize.second) {
+            return false;
+        }
+        offset += blockSize.second;
+
+        Block block;
+        bool succeed = false;
+        if (m_cipherDelegate != nullptr && m_cipherDelegate->isCipherDB()) {
+            block.setCipherDelegate(m_cipherDelegate);
+            succeed = block.decryptedDeserialize(blockData, false);
+        } else {
+            succeed = block.deserialize(blockData);
+        }
+        if (!succeed) {
+            return false;
+        }
+        block.apply(material);
+    }
+    return true;
+}
+
+#pragma mark - Block
+MaterialLog::Block::Block() = default;
+
+MaterialLog::Block::~Block() = default;
+
+MaterialLog::Block::Entry::Entry(Type type_) : type(type_)
+{
+}
+
+MaterialLog::Block::Entry::~Entry() = default;
+
+void MaterialLog::Block::diff(const std::list<Material::Content> &baseContents,
+                              const Material &material)
+{
+    StringViewMap<const Material::Content *> bases;
+    for (const auto &base : baseContents) {
+        bases.emplace(base.tableName, &base);
+    }
+    for (const auto &content : material.contentsList) {
+        auto iter = bases.find(content.tableName);
+        if (iter == bases.end() || isSchemaChanged(*iter->second, content)) {
+            entries.emplace_back(Entry::Type::Replaced);
+            entries.back().content = content;
+            if (iter != bases.end()) {
+                bases.erase(iter);
+            }
+            continue;
+        }
+        const Material::Content &base = *iter->second;
+
+        entries.emplace_back(Entry::Type::Patched);
+        Entry &entry = entries.back();
+        Material::VerifiedPages basePages = sortedPages(base.verifiedPagenos);
+        Material::VerifiedPages pages = sortedPages(content.verifiedPagenos);
+        auto basePage = basePages.begin();
+        auto page = pages.begin();
+        while (basePage != basePages.end() || page != pages.end()) {
+            if (page == pages.end()
+                || (basePage != basePages.end() && basePage->number < page->number)) {
+                entry.removedPagenos.push_back(basePage->number);
+                ++basePage;
+            } else if (basePage == basePages.end() || page->number < basePage->number) {
+                entry.upsertedPages.push_back(*page);
+                ++page;
+            } else {
+                if (basePage->hash != page->hash) {
+                    entry.upsertedPages.push_back(*page);
+                }
+                ++basePage;
+                ++page;
+            }
+        }
+        if (!entry.removedPagenos.empty() || !entry.upsertedPages.empty()
+            || base.sequence != content.sequence) {
+            entry.content.tableName = content.tableName;
+            entry.content.sequence = content.sequence;
+        } else {
+            // Unchanged
+            entries.pop_back();
+        }
+        bases.erase(iter);
+    }
+    for (const auto &base : bases) {
+        entries.emplace_back(Entry::Type::Removed);
+        entries.back().content.tableName = base.first;
+    }
+}
+
+void MaterialLog::Block::apply(Material &material) const
+{
+    auto &contentsList = material.contentsList;
+    auto &contentsMap = material.contentsMap;
+    auto find = [&contentsList](const UnsafeStringView &tableName) {
+        return std::find_if(
+        contentsList.begin(), contentsList.end(), [&tableName](const Material::Content &content) {
+            return content.tableName == tableName;
+        });
+    };
+
+    std::list<Material::Content> changedContents;
+    for (const auto &entry : entries) {
+        const StringView &tableName = entry.content.tableName;
+        auto iter = find(tableName);
+        switch (entry.type) {
+        case Entry::Type::Removed:
+            if (iter != contentsList.end()) {
+                contentsMap.erase(tableName);
+                contentsList.erase(iter);
+            }
+            break;
+        case Entry::Type::Replaced:
+            if (iter != contentsList.end()) {
+                contentsMap.erase(tableName);
+                contentsList.erase(iter);
+            }
+            changedContents.push_back(entry.content);
+            break;
+        case Entry::Type::Patched: {
+            if (iter == contentsList.end()) {
+                // The table is not found in base, which should not happen.
+                break;
+            }
+            Material::VerifiedPages pages = sortedPages(iter->verifiedPagenos);
+            Material::VerifiedPages merged;
+            merged.reserve(pages.size() + entry.upsertedPages.size());
+            auto removed = entry.removedPagenos.begin();
+            auto upserted = entry.upsertedPages.begin();
+            for (const auto &page : pages) {
+                while (upserted != entry.upsertedPages.end()
+                       && upserted->number < page.number) {
+                    merged.push_back(*upserted);
+                    ++upserted;
+                }
+                while (removed != entry.removedPagenos.end() && *removed < page.number) {
+                    ++removed;
+                }
+                if (removed != entry.removedPagenos.end() && *removed == page.number) {
+                    continue;
+                }
+                if (upserted != entry.upsertedPages.end() && upserted->number == page.number) {
+                    merged.push_back(*upserted);
+                    ++upserted;
+                    continue;
+                }
+                merged.push_back(page);
+            }
+            merged.insert(merged.end(), upserted, entry.upsertedPages.end());
+            iter->verifiedPagenos = std::move(merged);
+            iter->sequence = entry.content.sequence;
+            contentsMap.erase(tableName);
+            changedContents.splice(changedContents.end(), contentsList, iter);
+        } break;
+        }
+    }
+
+    // Changed contents are moved to the front, which is the same as what incremental backup does.
+    for (auto &content : changedContents) {
+        contentsMap[content.tableName] = &content;
+    }
+    contentsList.splice(contentsList.begin(), changedContents);
+    material.info = info;
+}
+
+bool MaterialLog::Block::isSchemaChanged(const Material::Content &base,
+                                         const Material::Content &content)
+{
+    return base.rootPage != content.rootPage || base.sql != content.sql
+           || base.associatedSQLs != content.associatedSQLs;
+}
+
+Material::VerifiedPages MaterialLog::Block::sortedPages(const Material::VerifiedPages &pages)
+{
+    Material::VerifiedPages sorted;
+    sorted.reserve(pages.size());
+    for (const auto &page : pages) {
+        // Deleted pages
+        if (page.number != 0) {
+            sorted.push_back(page);
+        }
+    }
+    std::sort(sorted.begin(), sorted.end(), [](const Material::Page &a, const Material::Page &b) {
+        return a.number < b.number;
+    });
+    return sorted;
+}
+
+#pragma mark - Serializable
+bool MaterialLog::Block::serialize(Serialization &serialization) const
+{
+    if (!info.serialize(serialization)) {
+        return false;
+    }
+
+    Serialization encoder;
+    for (const auto &entry : entries) {
+        if (!serializeEntry(encoder, entry)) {
+            return false;
+        }
+    }
+    Data data = encoder.finalize();
+    uint32_t checksum = data.empty() ? 0 : data.hash();
+    return serialization.put4BytesUInt(checksum) && serialization.putSizedData(data);
+}
+
+bool MaterialLog::Block::serializeEntry(Serialization &serialization, const Entry &entry)
+{
+    const Material::Content &content = entry.content;
+    if (content.tableName.empty()) {
+        markAsEmpty("TableName");
+        return false;
+    }
+    if (!serialization.putVarint((uint64_t) entry.type)) {
+        return false;
+    }
+    switch (entry.type) {
+    case Entry::Type::Removed:
+        return serialization.putSizedString(content.tableName);
+    case Entry::Type::Replaced:
+        if (content.sql.length() == 0) {
+            markAsEmpty("SQL");
+            return false;
+        }
+        return content.serialize(serialization);
+    case Entry::Type::Patched:
+        break;
+    }
+
+    if (!serialization.putSizedString(content.tableName)
+        || !serialization.putVarint(content.sequence)) {
+        return false;
+    }
+    if (!serialization.putVarint(entry.removedPagenos.size())) {
+        return false;
+    }
+    uint32_t prePageNo = 0;
+    for (uint32_t pageno : entry.removedPagenos) {
+        WCTAssert(pageno > prePageNo);
+        if (!serialization.putVarint(pageno - prePageNo)) {
+            return false;
+        }
+        prePageNo = pageno;
+    }
+    if (!serialization.putVarint(entry.upsertedPages.size())) {
+        return false;
+    }
+    prePageNo = 0;
+    for (const auto &page : entry.upsertedPages) {
+        WCTAssert(page.number > prePageNo);
+        if (!serialization.putVarint(page.number - prePageNo)
+            || !serialization.put4BytesUInt(page.hash)) {
+            return false;
+        }
+        prePageNo = page.number;
+    }
+    return true;
+}
+
+#pragma mark - Deserializable
+bool MaterialLog::Block::deserialize(Deserialization &deserialization)
+{
+    deserialization.setDataVersion(materialVersion);
+    if (!info.deserialize(deserialization)) {
+        return false;
+    }
+
+    if (!deserialization.canAdvance(sizeof(uint32_t))) {
+        markAsCorrupt("Checksum");
+        return false;
+    }
+    uint32_t checksum = deserialization.advance4BytesUInt();
+    auto intermediate = deserialization.advanceSizedData();
+    if (intermediate.first == 0) {
+        markAsCorrupt("Entries");
+        return false;
+    }
+    Data data;
+    data = intermediate.second;
+    if (checksum != (data.empty() ? 0 : data.hash())) {
+        markAsCorrupt("Checksum");
+        return false;
+    }
+
+    Deserialization decoder(data);
+    decoder.setDataVersion(materialVersion);
+    while (!decoder.ended()) {
+        auto type = decoder.advanceVarint();
+        if (type.first == 0 || type.second > (uint64_t) Entry::Type::Patched) {
+            markAsCorrupt("EntryType");
+            return false;
+        }
+        entries.emplace_back((Entry::Type) type.second);
+        if (!deserializeEntry(decoder, entries.back())) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool MaterialLog::Block::deserializeEntry(Deserialization &deserialization, Entry &entry)
+{
+    Material::Content &content = entry.content;
+    if (entry.type == Entry::Type::Replaced) {
+        return content.deserialize(deserialization);
+    }
+
+    size_t lengthOfSizedString;
+    std::tie(lengthOfSizedString, content.tableName) = deserialization.advanceSizedString();
+    if (lengthOfSizedString == 0 || content.tableName.empty()) {
+        markAsCorrupt("TableName");
+        return false;
+    }
+    if (entry.type == Entry::Type::Removed) {
+        return true;
+    }
+
+    auto sequence = deserialization.advanceVarint();
+    if (sequence.first == 0) {
+        markAsCorrupt("Sequence");
+        return false;
+    }
+    content.sequence = (int64_t) sequence.second;
+
+    auto numberOfRemovedPages = deserialization.advanceVarint();
+    if (numberOfRemovedPages.first == 0) {
+        markAsCorrupt("NumberOfRemovedPages");
+        return false;
+    }
+    entry.removedPagenos.reserve((size_t) numberOfRemovedPages.second);
+    uint64_t prePageNo = 0;
+    for (uint64_t i = 0; i < numberOfRemovedPages.second; ++i) {
+        auto delta = deserialization.advanceVarint();
+        if (delta.first == 0) {
+            markAsCorrupt("RemovedPageno");
+            return false;
+        }
+        prePageNo += delta.second;
+        entry.removedPagenos.push_back((uint32_t) prePageNo);
+    }
+
+    auto numberOfUpsertedPages = deserialization.advanceVarint();
+    if (numberOfUpsertedPages.first == 0) {
+        markAsCorrupt("NumberOfUpsertedPages");
+        return false;
+    }
+    entry.upsertedPages.reserve((size_t) numberOfUpsertedPages.second);
+    prePageNo = 0;
+    for (uint64_t i = 0; i < numberOfUpsertedPages.second; ++i) {
+        auto delta = deserialization.advanceVarint();
+        if (delta.first == 0 || !deserialization.canAdvance(4)) {
+            markAsCorrupt("UpsertedPage");
+            return false;
+        }
+        prePageNo += delta.second;
+        entry.upsertedPages.emplace_back((uint32_t) prePageNo,
+                                         deserialization.advance4BytesUInt());
+    }
+    return true;
+}
+
+void MaterialLog::Block::decryptFail(const UnsafeStringView &element) const
+{
+    markAsCorrupt(element);
+}
+
+CipherDelegate *MaterialLog::Block::getCipherDelegate() const
+{
+    return m_cipherDelegate;
+}
+
+} // namespace Repair
+
+} //namespace WCDB
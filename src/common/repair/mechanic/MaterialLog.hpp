@@ -0,0 +1,139 @@
+//
+// Created by qiuwenchen on 2026/10/16.
+//
+
+/*
+ * Tencent is pleased to support the open source community by making
+ * WCDB available.
+ *
+ * Copyright (C) 2017 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the BSD 3-Clause License (the "License"); you may not use
+ * this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *       https://opensource.org/licenses/BSD-3-Clause
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "EncryptedSerialization.hpp"
+#include "Material.hpp"
+#include "SharedThreadedErrorProne.hpp"
+#include "StringView.hpp"
+#include <list>
+#include <vector>
+
+namespace WCDB {
+
+namespace Repair {
+
+// Material log is an append-only file next to the latest material.
+// Each incremental backup appends a block that only contains the changed tables and pages,
+// so that the full material is rewritten only when the log is compacted.
+class MaterialLog final : public CipherDelegateHolder, protected SharedThreadedErrorProne {
+#pragma mark - Initialize
+public:
+    MaterialLog(const UnsafeStringView &path);
+    ~MaterialLog() override;
+
+    const StringView &getPath() const;
+
+protected:
+    StringView m_path;
+
+#pragma mark - Header
+protected:
+    static constexpr const uint32_t magic = 0x5743444C;
+    static constexpr const uint32_t version = 0x01000000; //1.0.0.0
+    // Version of material that contents are encoded with.
+    static constexpr const uint32_t materialVersion = 0x01000001; //1.0.0.1
+    static constexpr const int headerSize
+    = sizeof(magic) + sizeof(version) + sizeof(uint32_t); //magic + version + base checksum
+
+    static void markAsCorrupt(const UnsafeStringView &element);
+    static void markAsEmpty(const UnsafeStringView &element);
+
+#pragma mark - Append
+public:
+    // Append the changes from base contents to material as a new block.
+    // The log will be created with the contents checksum of base material if it doesn't exist.
+    bool append(uint32_t baseChecksum,
+                const std::list<Material::Content> &baseContents,
+                const Material &material);
+    bool reset();
+
+#pragma mark - Replay
+public:
+    // Apply all the blocks to material one after another.
+    // Return false if the log is not based on material or it's broken, in which case it should be compacted.
+    // Material is always left at the boundary of blocks.
+    bool replay(Material &material);
+
+#pragma mark - Block
+protected:
+    class Block final : public EncryptedSerializable,
+                        public DecryptedDeserializable,
+                        public CipherDelegateHolder {
+    public:
+        Block();
+        ~Block() override;
+
+        class Entry final {
+        public:
+            enum class Type {
+                Removed = 0,
+                Replaced = 1,
+                Patched = 2,
+            };
+            Entry(Type type);
+            ~Entry();
+
+            Type type;
+            // Only table name is valid for removed entry, and only table name and sequence are valid for patched entry.
+            Material::Content content;
+            std::vector<uint32_t> removedPagenos;
+            Material::VerifiedPages upsertedPages;
+        };
+
+        Material::Info info;
+        std::list<Entry> entries;
+
+        void diff(const std::list<Material::Content> &baseContents, const Material &material);
+        void apply(Material &material) const;
+
+    protected:
+        static bool isSchemaChanged(const Material::Content &base,
+                                    const Material::Content &content);
+        static Material::VerifiedPages sortedPages(const Material::VerifiedPages &pages);
+
+#pragma mark - Serializable
+    public:
+        bool serialize(Serialization &serialization) const override final;
+        using Serializable::serialize;
+
+    protected:
+        static bool serializeEntry(Serialization &serialization, const Entry &entry);
+
+#pragma mark - Deserializable
+    public:
+        bool deserialize(Deserialization &deserialization) override final;
+        using Deserializable::deserialize;
+
+    protected:
+        static bool deserializeEntry(Deserialization &deserialization, Entry &entry);
+        void decryptFail(const UnsafeStringView &element) const override final;
+        CipherDelegate *getCipherDelegate() const override;
+    };
+};
+
+} //namespace Repair
+
+} //namespace WCDB
@@ -119,6 +119,36 @@ MappedData PageBasedFileHandle::mapPage(int pageno,
     return MappedData::null();
 }
 
+Data PageBasedFileHandle::readPages(int pageno, int count, SharedHighWater highWater, bool reportError)
+{
+    Range range = pagesRange(pageno, count);
+    if (range.length == 0) {
+        return Data::null();
+    }
+    return read(range.location, range.length, highWater, reportError);
+}
+
+void PageBasedFileHandle::adviseReadaheadPages(int pageno, int count)
+{
+    Range range = pagesRange(pageno, count);
+    if (range.length > 0) {
+        adviseReadahead(range.location, range.length);
+    }
+}
+
+Range PageBasedFileHandle::pagesRange(int pageno, int count)
+{
+    WCTAssert(m_pageSize > 0);
+    WCTAssert(pageno > 0 && count > 0);
+    // The file size is fixed after opened in readonly mode, so it is safe to be read concurrently.
+    ssize_t fileSize = size();
+    offset_t offset = (offset_t) (pageno - 1) * m_pageSize;
+    if (fileSize <= 0 || offset >= (offset_t) fileSize) {
+        return Range(0, 0);
+    }
+    return Range(offset, std::min<offset_t>(count * m_pageSize, fileSize - offset));
+}
+
 #pragma mark - PageSize
 MappedData PageBasedFileHandle::mapPage(int pageno, SharedHighWater highWater)
 {
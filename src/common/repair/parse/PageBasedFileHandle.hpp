@@ -41,7 +41,15 @@ public:
     mapPage(int pageno, offset_t offset, size_t size, SharedHighWater highWater = nullptr);
     MappedData mapPage(int pageno, SharedHighWater highWater = nullptr);
 
+    // Read the adjacent pages [pageno, pageno + count) by one positional read, which is thread-safe.
+    Data readPages(int pageno,
+                   int count,
+                   SharedHighWater highWater = nullptr,
+                   bool reportError = true);
+    void adviseReadaheadPages(int pageno, int count);
+
 protected:
+    Range pagesRange(int pageno, int count);
     static Range
     restrictedRange(Range::Location base, Range::Length maxLength, const Range& restrictor);
 
@@ -0,0 +1,160 @@
+//
+// Created by qiuwenchen on 2026/10/16.
+//
+
+/*
+ * Tencent is pleased to support the open source community by making
+ * WCDB available.
+ *
+ * Copyright (C) 2017 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the BSD 3-Clause License (the "License"); you may not use
+ * this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *       https://opensource.org/licenses/BSD-3-Clause
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PagePrefetcher.hpp"
+#include "Assertion.hpp"
+#include "CoreConst.h"
+#include "Pager.hpp"
+#include "WorkerPool.hpp"
+
+namespace WCDB {
+
+namespace Repair {
+
+PagePrefetcher::PagePrefetcher(Pager *pager, int maxNumberOfJobs)
+: m_pager(pager)
+, m_numberOfConsumptions(0)
+, m_maxNumberOfJobs(maxNumberOfJobs)
+, m_numberOfJobs(0)
+, m_stopped(false)
+{
+    WCTAssert(m_pager != nullptr);
+    WCTAssert(m_maxNumberOfJobs > 0);
+}
+
+PagePrefetcher::~PagePrefetcher()
+{
+    stop();
+}
+
+WorkerPool &PagePrefetcher::workers()
+{
+    static WorkerPool *g_workers
+    = new WorkerPool(RepairWorkerPoolName, RepairMaxNumberOfWorkers);
+    return *g_workers;
+}
+
+void PagePrefetcher::schedule(const std::vector<int> &pagenos)
+{
+    int numberOfJobs;
+    {
+        std::lock_guard<std::mutex> lockGuard(m_lock);
+        m_pendings.insert(m_pendings.begin(), pagenos.begin(), pagenos.end());
+        numberOfJobs = prepareJobs();
+    }
+    dispatch(numberOfJobs);
+}
+
+void PagePrefetcher::consume(int pageno)
+{
+    int numberOfJobs;
+    {
+        std::lock_guard<std::mutex> lockGuard(m_lock);
+        ++m_numberOfConsumptions;
+        if (!m_pendings.empty() && m_pendings.front() == pageno) {
+            // Workers fall behind. The crawler loads it by itself.
+            m_pendings.pop_front();
+        } else {
+            m_prefetched.erase(pageno);
+        }
+        // The pages that are still not consumed after the crawler reaches so many other pages are skipped by crawler,
+        // e.g. the subtrees of a corrupted page, or they are already purged from cache.
+        // Release them so that they will not block the further prefetching.
+        while (!m_prefetchedOrder.empty()
+               && m_prefetchedOrder.front().second + RepairMaxNumberOfPrefetchedPages
+                  <= m_numberOfConsumptions) {
+            m_prefetched.erase(m_prefetchedOrder.front().first);
+            m_prefetchedOrder.pop_front();
+        }
+        numberOfJobs = prepareJobs();
+    }
+    dispatch(numberOfJobs);
+}
+
+void PagePrefetcher::stop()
+{
+    std::unique_lock<std::mutex> lockGuard(m_lock);
+    m_stopped = true;
+    m_pendings.clear();
+    // The jobs that are not started yet return immediately.
+    m_conditional.wait(lockGuard, [this]() { return m_numberOfJobs == 0; });
+}
+
+int PagePrefetcher::prepareJobs()
+{
+    // Limit the number of pages ahead of the crawler so that they will not be purged from cache before being crawled.
+    if (m_stopped || m_pendings.empty()
+        || m_prefetched.size() >= RepairMaxNumberOfPrefetchedPages) {
+        return 0;
+    }
+    int numberOfBatches
+    = (int) ((m_pendings.size() + RepairMaxNumberOfPagesPerPrefetch - 1) / RepairMaxNumberOfPagesPerPrefetch);
+    int numberOfJobs = std::min(numberOfBatches, m_maxNumberOfJobs) - m_numberOfJobs;
+    if (numberOfJobs <= 0) {
+        return 0;
+    }
+    m_numberOfJobs += numberOfJobs;
+    return numberOfJobs;
+}
+
+void PagePrefetcher::dispatch(int numberOfJobs)
+{
+    if (numberOfJobs <= 0) {
+        return;
+    }
+    std::shared_ptr<PagePrefetcher> prefetcher = shared_from_this();
+    for (int i = 0; i < numberOfJobs; ++i) {
+        workers().async([prefetcher]() { prefetcher->run(); });
+    }
+}
+
+void PagePrefetcher::run()
+{
+    std::vector<int> pagenos;
+    while (true) {
+        pagenos.clear();
+        {
+            std::lock_guard<std::mutex> lockGuard(m_lock);
+            if (m_stopped || m_pendings.empty()
+                || m_prefetched.size() >= RepairMaxNumberOfPrefetchedPages) {
+                --m_numberOfJobs;
+                m_conditional.notify_all();
+                return;
+            }
+            // Take a batch of pages so that the adjacent ones can be read together.
+            while (!m_pendings.empty() && pagenos.size() < RepairMaxNumberOfPagesPerPrefetch) {
+                int pageno = m_pendings.front();
+                m_pendings.pop_front();
+                pagenos.push_back(pageno);
+                m_prefetched.emplace(pageno);
+                m_prefetchedOrder.emplace_back(pageno, m_numberOfConsumptions);
+            }
+        }
+        m_pager->prefetchPageData(pagenos);
+    }
+}
+
+} //namespace Repair
+
+} //namespace WCDB
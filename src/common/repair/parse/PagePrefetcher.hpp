@@ -0,0 +1,81 @@
+//
+// Created by qiuwenchen on 2026/10/16.
+//
+
+/*
+ * Tencent is pleased to support the open source community by making
+ * WCDB available.
+ *
+ * Copyright (C) 2017 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the BSD 3-Clause License (the "License"); you may not use
+ * this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *       https://opensource.org/licenses/BSD-3-Clause
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "Lock.hpp"
+#include <deque>
+#include <memory>
+#include <set>
+#include <vector>
+
+namespace WCDB {
+
+class WorkerPool;
+
+namespace Repair {
+
+class Pager;
+
+// Load pages into the cache of pager by workers, ahead of the crawling thread.
+// The workers are shared among all prefetchers and kept alive across crawls.
+class PagePrefetcher final : public std::enable_shared_from_this<PagePrefetcher> {
+public:
+    PagePrefetcher(Pager *pager, int maxNumberOfJobs);
+    ~PagePrefetcher();
+
+    PagePrefetcher() = delete;
+    PagePrefetcher(const PagePrefetcher &) = delete;
+    PagePrefetcher &operator=(const PagePrefetcher &) = delete;
+
+    // The latest scheduled pages are prefetched first since the crawler goes depth-first.
+    void schedule(const std::vector<int> &pagenos);
+    // The page is reached by crawler and should not be prefetched any more.
+    void consume(int pageno);
+    // It returns after all the running jobs return, so that the pager is no longer used.
+    void stop();
+
+protected:
+    static WorkerPool &workers();
+    int prepareJobs();
+    void dispatch(int numberOfJobs);
+    void run();
+
+    Pager *m_pager;
+    std::mutex m_lock;
+    Conditional m_conditional;
+    std::deque<int> m_pendings;
+    // prefetched but not yet consumed
+    std::set<int> m_prefetched;
+    // prefetched pages with the number of consumptions when they are prefetched, in prefetching order
+    std::deque<std::pair<int, uint64_t>> m_prefetchedOrder;
+    uint64_t m_numberOfConsumptions;
+    const int m_maxNumberOfJobs;
+    int m_numberOfJobs;
+    bool m_stopped;
+};
+
+} //namespace Repair
+
+} //namespace WCDB
@@ -31,6 +31,7 @@
 #include "Serialization.hpp"
 #include "StringView.hpp"
 #include "ThreadedErrors.hpp"
+#include <algorithm>
 #include <cstring>
 
 namespace WCDB {
@@ -49,6 +50,7 @@ Pager::Pager(const UnsafeStringView& path)
 , m_wal(this)
 , m_walImportance(true)
 , m_skipWal(false)
+, m_pageSource(PageSource::Mapped)
 , m_cache(maxAllowedCacheMemory)
 , m_highWater(std::make_shared<ShareableHighWater>())
 {
@@ -120,29 +122,130 @@ UnsafeData Pager::acquirePageData(int number, offset_t offset, size_t size)
     WCTAssert(isInitialized());
     WCTAssert(number > 0);
     WCTAssert(offset + size <= m_pageSize);
+    std::lock_guard<std::mutex> lockGuard(m_lock);
+    ++m_statistics.acquiredCount;
     if (m_cache.exists(number)) {
+        ++m_statistics.cacheHitCount;
+        markPageAsAcquired(number);
         return m_cache.get(number).subdata(offset, size);
     }
+    UnsafeData data = readPageData(number, true);
+    if (data.empty()) {
+        return MappedData::null();
+    }
+    markPageAsAcquired(number);
+    m_cache.insert(number, data);
+    tryPurgeCache();
+    return data.subdata(offset, size);
+}
+
+void Pager::prefetchPageData(const std::vector<int>& numbers)
+{
+    WCTAssert(isInitialized());
+    std::vector<int> unreadNumbers;
+    {
+        std::lock_guard<std::mutex> lockGuard(m_lock);
+        for (int number : numbers) {
+            if (number <= 0 || m_cache.exists(number)) {
+                continue;
+            }
+            if (!m_wal.containsPage(number)) {
+                // The pages of main file are read outside the lock whatever the page source is,
+                // since the mapping is not thread-safe.
+                if (number <= m_numberOfPages) {
+                    unreadNumbers.push_back(number);
+                }
+                continue;
+            }
+            // The failures are left to the later acquirement, which reports them in the crawling thread.
+            UnsafeData data = readPageData(number, false);
+            if (!data.empty()) {
+                m_cache.insert(number, data);
+            }
+        }
+        tryPurgeCache();
+    }
+    if (unreadNumbers.empty()) {
+        return;
+    }
+    std::sort(unreadNumbers.begin(), unreadNumbers.end());
+    unreadNumbers.erase(std::unique(unreadNumbers.begin(), unreadNumbers.end()),
+                        unreadNumbers.end());
+
+    // Coalesce the adjacent pages into one read.
+    std::vector<std::pair<int, int>> runs;
+    for (int number : unreadNumbers) {
+        if (!runs.empty() && runs.back().first + runs.back().second == number) {
+            ++runs.back().second;
+        } else {
+            runs.emplace_back(number, 1);
+        }
+    }
+    // Advise all the runs before reading any of them, so that they are loaded by system concurrently.
+    for (const auto& run : runs) {
+        m_fileHandle.adviseReadaheadPages(run.first, run.second);
+    }
+    for (const auto& run : runs) {
+        // Positional read is thread-safe so that it can be done without lock.
+        // The failures are left to the later acquirement as well.
+        Data data = m_fileHandle.readPages(run.first, run.second, m_highWater, false);
+
+        std::lock_guard<std::mutex> lockGuard(m_lock);
+        m_statistics.loadedPageCount += run.second;
+        m_statistics.loadedBytes += data.size();
+        for (int i = 0; i < run.second; ++i) {
+            int number = run.first + i;
+            if ((size_t) (i + 1) * m_pageSize > data.size() || m_cache.exists(number)) {
+                continue;
+            }
+            UnsafeData pageData
+            = decodePageData(number, data.subdata(i * m_pageSize, m_pageSize), false);
+            if (!pageData.empty()) {
+                m_cache.insert(number, pageData);
+            }
+        }
+        tryPurgeCache();
+    }
+}
+
+UnsafeData Pager::readPageData(int number, bool reportError)
+{
     UnsafeData data;
     if (m_wal.containsPage(number)) {
         data = m_wal.acquirePageData(number, m_highWater);
     } else {
         if (number > m_numberOfPages) {
-            markAsCorrupted(
-            number,
-            StringView::formatted(
-            "Acquired page number: %d exceeds the page count: %d.", number, m_numberOfPages));
+            if (reportError) {
+                markAsCorrupted(
+                number,
+                StringView::formatted(
+                "Acquired page number: %d exceeds the page count: %d.", number, m_numberOfPages));
+            }
             return MappedData::null();
         }
-        data = m_fileHandle.mapPage(number, m_highWater);
+        if (m_pageSource == PageSource::Read) {
+            data = m_fileHandle.readPages(number, 1, m_highWater, reportError);
+        } else {
+            data = m_fileHandle.mapPage(number, m_highWater);
+        }
     }
+    ++m_statistics.loadedPageCount;
+    m_statistics.loadedBytes += data.size();
+    return decodePageData(number, data, reportError);
+}
+
+UnsafeData Pager::decodePageData(int number, UnsafeData data, bool reportError)
+{
     if (data.size() != m_pageSize) {
+        if (!reportError) {
+            return MappedData::null();
+        }
         if (data.size() > 0) {
             //short read
             markAsCorrupted(number,
                             StringView::formatted("Acquired page data with size: %d is less than the expected size: %d.",
                                                   data.size(),
-                                                  size));
+                                                  m_pageSize));
         } else {
             assignWithSharedThreadedError();
         }
@@ -151,14 +254,14 @@ UnsafeData Pager::acquirePageData(int number, offset_t offset, size_t size)
     if (m_pCodec) {
         void* decodedBuffer = sqlite3Codec(m_pCodec, data.buffer(), number, 4);
         if (decodedBuffer == nullptr) {
-            markAsCorrupted(number, "Decode page data fail!");
+            if (reportError) {
+                markAsCorrupted(number, "Decode page data fail!");
+            }
             return MappedData::null();
         }
-        data = Data(reinterpret_cast<unsigned char*>(decodedBuffer), m_pageSize, m_highWater);
+        return Data(reinterpret_cast<unsigned char*>(decodedBuffer), m_pageSize, m_highWater);
     }
-    m_cache.insert(number, data);
-    tryPurgeCache();
-    return data.subdata(offset, size);
+    return data;
 }
 
 UnsafeData Pager::acquireHeader()
@@ -253,6 +356,13 @@ bool Pager::containPageInWal(uint32_t pageno)
     return m_wal.containsPage(pageno);
 }
 
+#pragma mark - Page Source
+void Pager::setPageSource(PageSource pageSource)
+{
+    WCTAssert(!isInitialized());
+    m_pageSource = pageSource;
+}
+
 #pragma mark - Error
 void Pager::markAsCorrupted(int page, const UnsafeStringView& message)
 {
@@ -398,6 +508,50 @@ void Pager::Cache::willPurge(const uint32_t& pageNum, const UnsafeData& data)
     m_currentUsedMemery -= data.size();
 }
 
+#pragma mark - Statistics
+Pager::Statistics::Statistics()
+: acquiredCount(0)
+, cacheHitCount(0)
+, loadedPageCount(0)
+, loadedBytes(0)
+, requiredBytes(0)
+{
+}
+
+double Pager::Statistics::getCacheHitRate() const
+{
+    return acquiredCount > 0 ? (double) cacheHitCount / acquiredCount : 0;
+}
+
+double Pager::Statistics::getReadAmplification() const
+{
+    return requiredBytes > 0 ? (double) loadedBytes / requiredBytes : 0;
+}
+
+Pager::Statistics Pager::getStatistics() const
+{
+    std::lock_guard<std::mutex> lockGuard(m_lock);
+    return m_statistics;
+}
+
+void Pager::markPageAsAcquired(int number)
+{
+    WCTAssert(number > 0);
+    // A corrupted page number should never make it allocate a large amount of memory,
+    // so the pages beyond the main file and the wal are not tracked.
+    int numberOfPages = getNumberOfPages();
+    if (number > numberOfPages) {
+        return;
+    }
+    if ((size_t) number > m_acquiredPages.size()) {
+        m_acquiredPages.resize(numberOfPages, false);
+    }
+    if (!m_acquiredPages[number - 1]) {
+        m_acquiredPages[number - 1] = true;
+        m_statistics.requiredBytes += m_pageSize;
+    }
+}
+
 } //namespace Repair
 
 } //namespace WCDB
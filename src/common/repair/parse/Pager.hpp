@@ -30,6 +30,8 @@
 #include "PageBasedFileHandle.hpp"
 #include "WCDBError.hpp"
 #include "Wal.hpp"
+#include <mutex>
+#include <vector>
 
 namespace WCDB {
 
@@ -59,6 +61,9 @@ public:
     int getNumberOfPages() const;
     UnsafeData acquirePageData(int number);
     UnsafeData acquirePageData(int number, offset_t offset, size_t size);
+    // thread-safe, load the pages into cache ahead of the acquirement.
+    // The pages of main file are loaded by positional reads without lock, and the adjacent ones are coalesced into one read.
+    void prefetchPageData(const std::vector<int>& numbers);
 
     int getUsableSize() const;
     int getPageSize() const;
@@ -67,6 +72,8 @@ public:
 
 protected:
     UnsafeData acquireHeader();
+    UnsafeData readPageData(int number, bool reportError);
+    UnsafeData decodePageData(int number, UnsafeData data, bool reportError);
     int m_pageSize;
     int m_reservedBytes;
     int m_numberOfPages;
@@ -98,6 +105,19 @@ protected:
     bool m_walImportance;
     bool m_skipWal;
 
+#pragma mark - Page Source
+public:
+    enum class PageSource {
+        // Map the file by ranges on demand.
+        Mapped,
+        // Read the pages by positional reads.
+        Read,
+    };
+    void setPageSource(PageSource pageSource);
+
+protected:
+    PageSource m_pageSource;
+
 #pragma mark - Error
 public:
     void markAsCorrupted(int page, const UnsafeStringView& message);
@@ -127,6 +147,34 @@ protected:
     void tryPurgeCache();
     Cache m_cache;
     SharedHighWater m_highWater;
+    // Page cache, file handle, wal and codec are all shared with the prefetching workers.
+    mutable std::mutex m_lock;
+
+#pragma mark - Statistics
+public:
+    struct Statistics {
+        Statistics();
+        // number of page acquirements
+        uint64_t acquiredCount;
+        // number of page acquirements hit in cache
+        uint64_t cacheHitCount;
+        // number of pages loaded from file or wal, including the prefetched ones
+        uint64_t loadedPageCount;
+        uint64_t loadedBytes;
+        // size of the distinct pages acquired
+        uint64_t requiredBytes;
+
+        double getCacheHitRate() const;
+        // loaded bytes per required byte
+        double getReadAmplification() const;
+    };
+    Statistics getStatistics() const; // thread-safe
+
+protected:
+    // Only the valid pages read successfully are marked.
+    void markPageAsAcquired(int number);
+    Statistics m_statistics;
+    std::vector<bool> m_acquiredPages;
 };
 
 } //namespace Repair
@@ -26,26 +26,118 @@
 
 #include "Assertion.hpp"
 #include "Exiting.hpp"
+#include "Lock.hpp"
 #include "Time.hpp"
-#include "UniqueList.hpp"
 #include <condition_variable>
+#include <functional>
 #include <list>
+#include <map>
 #include <stdio.h>
+#include <vector>
 
 namespace WCDB {
 
-template<typename Key, typename Info>
+// Elements are indexed by key in a map, and ordered by expired time in a binary min-heap,
+// so that both of queueing and removing are O(logN).
+template<typename Key, typename Info, typename Comparator = std::less<Key>>
 class TimedQueue final {
 private:
-    typedef UniqueList<Key, Info, SteadyClock> List;
-    List m_list;
+    struct Element;
+    typedef std::map<Key, Element, Comparator> Elements;
+    typedef typename Elements::iterator Handle;
+    struct Element {
+        Info info;
+        SteadyClock expired;
+        // Elements with the same expired time are dequeued in the order they are queued.
+        uint64_t sequence;
+        // Position in heap
+        size_t index;
+    };
+    Elements m_elements;
+    std::vector<Handle> m_heap;
+    uint64_t m_sequence;
     Conditional m_conditional;
     std::mutex m_lock;
     bool m_stop;
     std::atomic<bool> m_running;
 
+#pragma mark - Heap
+    static bool earlier(const Handle &left, const Handle &right)
+    {
+        const Element &l = left->second;
+        const Element &r = right->second;
+        return l.expired < r.expired || (l.expired == r.expired && l.sequence < r.sequence);
+    }
+
+    void place(Handle handle, size_t index)
+    {
+        m_heap[index] = handle;
+        handle->second.index = index;
+    }
+
+    void siftUp(size_t index)
+    {
+        Handle handle = m_heap[index];
+        while (index > 0) {
+            size_t parent = (index - 1) / 2;
+            if (!earlier(handle, m_heap[parent])) {
+                break;
+            }
+            place(m_heap[parent], index);
+            index = parent;
+        }
+        place(handle, index);
+    }
+
+    void siftDown(size_t index)
+    {
+        Handle handle = m_heap[index];
+        size_t count = m_heap.size();
+        while (true) {
+            size_t child = 2 * index + 1;
+            if (child >= count) {
+                break;
+            }
+            if (child + 1 < count && earlier(m_heap[child + 1], m_heap[child])) {
+                ++child;
+            }
+            if (!earlier(m_heap[child], handle)) {
+                break;
+            }
+            place(m_heap[child], index);
+            index = child;
+        }
+        place(handle, index);
+    }
+
+    void reschedule(Handle handle, const SteadyClock &expired)
+    {
+        handle->second.expired = expired;
+        handle->second.sequence = ++m_sequence;
+        size_t index = handle->second.index;
+        siftUp(index);
+        if (handle->second.index == index) {
+            siftDown(index);
+        }
+    }
+
+    void erase(Handle handle)
+    {
+        size_t index = handle->second.index;
+        Handle last = m_heap.back();
+        m_heap.pop_back();
+        if (last != handle) {
+            place(last, index);
+            siftUp(index);
+            if (last->second.index == index) {
+                siftDown(index);
+            }
+        }
+        m_elements.erase(handle);
+    }
+
 public:
-    TimedQueue() : m_stop(false), m_running(false) {}
+    TimedQueue() : m_sequence(0), m_stop(false), m_running(false) {}
     ~TimedQueue()
     {
         stop();
@@ -76,12 +168,19 @@ public:
                 return;
             }
 
-            auto iter = m_list.find(key);
-            if (mode == Mode::ForwardOnly && iter != m_list.end() && iter->order() < expired) {
-                iter->value() = info;
+            auto iter = m_elements.find(key);
+            if (iter == m_elements.end()) {
+                iter = m_elements.emplace(key, Element{ info, expired, ++m_sequence, m_heap.size() })
+                       .first;
+                m_heap.push_back(iter);
+                siftUp(iter->second.index);
+                notify = m_heap.front() == iter;
+            } else if (mode == Mode::ForwardOnly && iter->second.expired < expired) {
+                iter->second.info = info;
             } else {
-                m_list.insert(key, info, expired);
-                notify = m_list.front().key() == key;
+                iter->second.info = info;
+                reschedule(iter, expired);
+                notify = m_heap.front() == iter;
             }
         }
         if (notify) {
@@ -96,7 +195,10 @@ public:
             if (m_stop) {
                 return;
             }
-            m_list.erase(key);
+            auto iter = m_elements.find(key);
+            if (iter != m_elements.end()) {
+                erase(iter);
+            }
         }
         if (isExiting()) {
             stop();
@@ -108,12 +210,19 @@ public:
     {
         {
             std::lock_guard<std::mutex> lockGuard(m_lock);
-            m_list.clear();
+            m_heap.clear();
+            m_elements.clear();
             m_stop = true;
         }
         m_conditional.notify_one();
     }
 
+    size_t size()
+    {
+        std::lock_guard<std::mutex> lockGuard(m_lock);
+        return m_heap.size();
+    }
+
     void waitUntilDone()
     {
         while (m_running.load())
@@ -130,22 +239,22 @@ public:
                 if (m_stop) {
                     break;
                 }
-                auto shortest = m_list.begin();
-                if (shortest == m_list.end()) {
+                if (m_heap.empty()) {
                     if (!isExiting()) {
                         m_conditional.wait(lockGuard);
                     }
                     continue;
                 }
-                double timeInterval = shortest->order().timeIntervalSinceNow();
+                Handle shortest = m_heap.front();
+                double timeInterval = shortest->second.expired.timeIntervalSinceNow();
                 if (timeInterval > 0) {
                     if (!isExiting()) {
                         m_conditional.wait_for(lockGuard, timeInterval);
                     }
                     continue;
                 }
-                expireds.push_back(std::make_pair(shortest->key(), shortest->value()));
-                m_list.erase(shortest);
+                expireds.push_back(std::make_pair(shortest->first, shortest->second.info));
+                erase(shortest);
             }
             if (!isExiting()) {
                 WCTAssert(expireds.size() == 1);
@@ -0,0 +1,133 @@
+//
+// Created by qiuwenchen on 2026/10/16.
+//
+
+/*
+ * Tencent is pleased to support the open source community by making
+ * WCDB available.
+ *
+ * Copyright (C) 2017 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the BSD 3-Clause License (the "License"); you may not use
+ * this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *       https://opensource.org/licenses/BSD-3-Clause
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "WorkerPool.hpp"
+#include "Assertion.hpp"
+#include "Thread.hpp"
+#include <memory>
+
+namespace WCDB {
+
+WorkerPool::WorkerPool(const UnsafeStringView &name_, int maxNumberOfWorkers)
+: name(name_), m_maxNumberOfWorkers(maxNumberOfWorkers), m_numberOfIdleWorkers(0), m_stopped(false)
+{
+    WCTAssert(maxNumberOfWorkers > 0);
+}
+
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lockGuard(m_lock);
+        m_stopped = true;
+        m_jobs.clear();
+        m_conditional.notify_all();
+    }
+    for (auto &worker : m_workers) {
+        worker.join();
+    }
+}
+
+void WorkerPool::parallelRun(const Job &job, int parallelism)
+{
+    int numberOfRuns = std::min(parallelism - 1, m_maxNumberOfWorkers);
+    if (numberOfRuns <= 0) {
+        job();
+        return;
+    }
+    struct State {
+        int numberOfRunning = 0;
+        bool finished = false;
+        Conditional conditional;
+    };
+    std::shared_ptr<State> state = std::make_shared<State>();
+    {
+        std::lock_guard<std::mutex> lockGuard(m_lock);
+        for (int i = 0; i < numberOfRuns; ++i) {
+            // The job is only touched before the run of current thread returns, so it's safe to be captured by reference.
+            m_jobs.push_back([this, state, &job]() {
+                {
+                    std::lock_guard<std::mutex> lockGuard(m_lock);
+                    if (state->finished) {
+                        return;
+                    }
+                    ++state->numberOfRunning;
+                }
+                job();
+                std::lock_guard<std::mutex> lockGuard(m_lock);
+                if (--state->numberOfRunning == 0 && state->finished) {
+                    state->conditional.notify_all();
+                }
+            });
+        }
+        dispatch();
+    }
+    job();
+    std::unique_lock<std::mutex> lockGuard(m_lock);
+    state->finished = true;
+    while (state->numberOfRunning > 0) {
+        state->conditional.wait(lockGuard);
+    }
+}
+
+void WorkerPool::async(const Job &job)
+{
+    std::lock_guard<std::mutex> lockGuard(m_lock);
+    if (m_stopped) {
+        return;
+    }
+    m_jobs.push_back(job);
+    dispatch();
+}
+
+void WorkerPool::dispatch()
+{
+    while (m_workers.size() < (size_t) m_maxNumberOfWorkers
+           && m_jobs.size() > (size_t) m_numberOfIdleWorkers) {
+        // The new worker is counted as idle until it takes a job.
+        ++m_numberOfIdleWorkers;
+        m_workers.emplace_back(&WorkerPool::loop, this);
+    }
+    m_conditional.notify_all();
+}
+
+void WorkerPool::loop()
+{
+    Thread::setName(name);
+    std::unique_lock<std::mutex> lockGuard(m_lock);
+    while (!m_stopped) {
+        if (m_jobs.empty()) {
+            m_conditional.wait(lockGuard);
+            continue;
+        }
+        Job job = std::move(m_jobs.front());
+        m_jobs.pop_front();
+        --m_numberOfIdleWorkers;
+        lockGuard.unlock();
+        job();
+        lockGuard.lock();
+        ++m_numberOfIdleWorkers;
+    }
+}
+
+} // namespace WCDB
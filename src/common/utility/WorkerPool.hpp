@@ -0,0 +1,73 @@
+//
+// Created by qiuwenchen on 2026/10/16.
+//
+
+/*
+ * Tencent is pleased to support the open source community by making
+ * WCDB available.
+ *
+ * Copyright (C) 2017 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the BSD 3-Clause License (the "License"); you may not use
+ * this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *       https://opensource.org/licenses/BSD-3-Clause
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "Lock.hpp"
+#include "StringView.hpp"
+#include <functional>
+#include <list>
+#include <thread>
+#include <vector>
+
+namespace WCDB {
+
+// WorkerPool keeps its threads alive among jobs, so that no thread is created per job,
+// and the thread-local resources of workers, e.g. ZSTD contexts, are reused.
+// Workers are created lazily when there are more pending jobs than idle workers.
+class WorkerPool final {
+public:
+    WorkerPool(const UnsafeStringView &name, int maxNumberOfWorkers);
+    ~WorkerPool();
+
+    WorkerPool() = delete;
+    WorkerPool(const WorkerPool &) = delete;
+    WorkerPool &operator=(const WorkerPool &) = delete;
+
+    typedef std::function<void()> Job;
+
+    // The job is run by the current thread and at most `parallelism - 1` workers at the same time.
+    // It should take its work from a source shared among the runs, since the runs that are not
+    // started by workers yet are cancelled after the run of current thread returns.
+    // It returns after all the started runs return.
+    void parallelRun(const Job &job, int parallelism);
+
+    void async(const Job &job);
+
+    const StringView name;
+
+private:
+    void dispatch();
+    void loop();
+
+    std::mutex m_lock;
+    Conditional m_conditional;
+    std::list<Job> m_jobs;
+    std::vector<std::thread> m_workers;
+    const int m_maxNumberOfWorkers;
+    int m_numberOfIdleWorkers;
+    bool m_stopped;
+};
+
+} // namespace WCDB
@@ -24,6 +24,7 @@
 
 #include "SQL.hpp"
 #include "Assertion.hpp"
+#include "SQLWriter.hpp"
 #include <atomic>
 
 namespace WCDB {
@@ -37,7 +38,7 @@ SQL::SQL(const SQL& other)
 {
 }
 
-SQL::SQL(SQL&& other)
+SQL::SQL(SQL&& other) noexcept
 : m_syntaxPtr(other.m_syntaxPtr)
 , m_description(other.m_hasDescription ? std::atomic_load(&other.m_description) : nullptr)
 , m_hasDescription(other.m_hasDescription)
@@ -61,7 +62,7 @@ SQL& SQL::operator=(const SQL& other)
     return *this;
 }
 
-SQL& SQL::operator=(SQL&& other)
+SQL& SQL::operator=(SQL&& other) noexcept
 {
     if (other.m_hasDescription) {
         m_description = std::atomic_load(&other.m_description);
@@ -114,6 +115,19 @@ StringView SQL::getDescription() const
     return *description.get();
 }
 
+UnsafeStringView SQL::getDescription(Syntax::SQLWriter& writer) const
+{
+    std::shared_ptr<StringView> description = std::atomic_load(&m_description);
+    if (description != nullptr) {
+        return *description;
+    }
+    if (syntax().isValid() && !syntax().describle(writer.stream())) {
+        WCTAssert(false);
+        return UnsafeStringView();
+    }
+    return writer.written();
+}
+
 Syntax::Identifier& SQL::syntax()
 {
     // Note that `syntax()` is not designed for thread-safe.
@@ -34,6 +34,10 @@
 
 namespace WCDB {
 
+namespace Syntax {
+class SQLWriter;
+}
+
 class WCDB_API SQL {
 public:
     SQL();
@@ -48,15 +52,18 @@ public:
     void iterate(const ConstIterator& iterator) const;
 
     StringView getDescription() const;
+    // Same as `getDescription()`, but the description is written into the writer if it's not cached yet,
+    // which is neither allocated nor cached. It's only valid until SQL is modified or writer is destructed.
+    UnsafeStringView getDescription(Syntax::SQLWriter& writer) const;
 
     virtual Syntax::Identifier& syntax();
     virtual const Syntax::Identifier& syntax() const;
 
 protected:
     SQL(const SQL& sql);
-    SQL(SQL&& sql);
+    SQL(SQL&& sql) noexcept;
     SQL& operator=(const SQL& other);
-    SQL& operator=(SQL&& other);
+    SQL& operator=(SQL&& other) noexcept;
 
     mutable Syntax::Identifier* m_syntaxPtr = nullptr;
     mutable std::shared_ptr<StringView> m_description;
@@ -100,7 +107,7 @@ public:
         this->m_syntaxPtr = &m_syntax;
     }
 
-    SpecifiedSyntax(Self&& other)
+    SpecifiedSyntax(Self&& other) noexcept
     : Super(std::move(other)), m_syntax(std::move(other.m_syntax))
     {
         this->m_syntaxPtr = &m_syntax;
@@ -116,7 +123,7 @@ public:
         return *this;
     }
 
-    Self& operator=(Self&& other)
+    Self& operator=(Self&& other) noexcept
     {
         Super::operator=(std::move(other));
         m_syntax = std::move(other.m_syntax);
@@ -321,7 +321,7 @@ BaseBinding::generateCreateVirtualTableStatement(const UnsafeStringView &tableNa
 {
     StatementCreateVirtualTable statement = statementVirtualTable;
     statement.createVirtualTable(tableName).ifNotExists();
-    std::list<StringView> &arguments = statement.syntax().arguments;
+    std::vector<StringView> &arguments = statement.syntax().arguments;
     bool isFTS5 = statement.syntax().module.caseInsensitiveEqual("fts5");
     for (const auto &iter : m_columnDefs) {
         if (isFTS5) {
@@ -25,26 +25,33 @@
 #pragma once
 
 #include "ValueArray.hpp"
+#include <algorithm>
 #include <cassert>
+#include <iterator>
 #include <list>
+#include <string>
 #include <type_traits>
+#include <vector>
 
 namespace WCDB {
 
 class SQL;
 
-// list is better than vector here by avoiding memory reallocation
-// we can add random accessibility for this list since the total size is small, usually less than 10
-// all other method is same as std::list, see also: http://www.cplusplus.com/reference/list/list/
+// Elements are stored contiguously, so that a long list, e.g. a 500-term IN-list or the values of
+// a multi-row insert, costs a few allocations instead of one per element.
+// Unlike std::list, references and iterators to the elements are invalidated when it grows.
+// The members of std::list that std::vector lacks are kept for compatibility, though the ones
+// working on the front or in the middle cost linear time.
+// All other method is same as std::vector, see also: http://www.cplusplus.com/reference/vector/vector/
 template<typename T>
-class _SyntaxList : public std::list<T> {
+class _SyntaxList : public std::vector<T> {
     static_assert(std::is_base_of<SQL, T>::value, "");
 
 protected:
-    using Super = std::list<T>;
+    using Super = std::vector<T>;
 
 public:
-    using std::list<T>::list;
+    using std::vector<T>::vector;
     typedef T SQLType;
     typedef typename T::SyntaxType SyntaxType;
 
@@ -87,6 +94,7 @@ public:
     template<typename U, typename Enable = typename std::enable_if<std::is_constructible<T, U>::value>::type>
     _SyntaxList(const SyntaxList<U>& others)
     {
+        this->reserve(others.size());
         for (const auto& other : others) {
             this->emplace_back(other);
         }
@@ -95,6 +103,7 @@ public:
     template<typename U, typename Enable = typename std::enable_if<std::is_constructible<T, U>::value>::type>
     _SyntaxList(const std::initializer_list<U>& others)
     {
+        this->reserve(others.size());
         for (const auto& other : others) {
             this->emplace_back(other);
         }
@@ -103,6 +112,7 @@ public:
     template<typename U, typename Enable = typename std::enable_if<std::is_constructible<T, U>::value>::type>
     _SyntaxList(const std::vector<U>& others)
     {
+        this->reserve(others.size());
         for (const auto& other : others) {
             this->emplace_back(other);
         }
@@ -111,6 +121,7 @@ public:
     template<typename U, typename Enable = typename std::enable_if<std::is_constructible<T, U>::value>::type>
     _SyntaxList(const ValueArray<U>& others)
     {
+        this->reserve(others.size());
         for (const auto& other : others) {
             this->emplace_back(other);
         }
@@ -126,50 +137,96 @@ public:
 
     virtual ~_SyntaxList() = default;
 
-    operator std::list<SyntaxType>() const
+#pragma mark - std::list compatible
+    void push_front(const T& t) { this->insert(this->begin(), t); }
+
+    void push_front(T&& t) { this->insert(this->begin(), std::move(t)); }
+
+    template<typename... Args>
+    void emplace_front(Args&&... args)
     {
-        std::list<SyntaxType> list;
-        for (const auto& sql : *this) {
-            list.push_back(sql.syntax());
-        }
-        return list;
+        this->emplace(this->begin(), std::forward<Args>(args)...);
     }
 
-    const T& operator[](size_t index) const
+    void pop_front() { this->erase(this->begin()); }
+
+    // Move all elements of others to the position, leaving others empty.
+    void splice(typename Super::const_iterator position, _SyntaxList& others)
     {
-        assert(index < this->size());
-        auto iter = this->begin();
-        while (index != 0) {
-            ++iter;
-            --index;
-        }
-        return *iter;
+        splice(position, others, others.begin(), others.end());
+    }
+
+    void splice(typename Super::const_iterator position, _SyntaxList&& others)
+    {
+        splice(position, others);
+    }
+
+    void splice(typename Super::const_iterator position,
+                _SyntaxList& others,
+                typename Super::const_iterator element)
+    {
+        splice(position, others, element, std::next(element));
+    }
+
+    void splice(typename Super::const_iterator position,
+                _SyntaxList& others,
+                typename Super::const_iterator first,
+                typename Super::const_iterator last)
+    {
+        assert(&others != this);
+        this->insert(position,
+                     std::make_move_iterator(others.begin() + (first - others.cbegin())),
+                     std::make_move_iterator(others.begin() + (last - others.cbegin())));
+        others.erase(first, last);
     }
 
-    T& operator[](size_t index)
+    // Elements are compared by their descriptions, since the comparison operators of WINQ build expressions.
+    void remove(const T& t)
     {
-        assert(index < this->size());
-        auto iter = this->begin();
-        while (index != 0) {
-            ++iter;
-            --index;
+        StringView description = t.getDescription();
+        remove_if([&description](const T& element) {
+            return element.getDescription().equal(description);
+        });
+    }
+
+    template<typename Predicate>
+    void remove_if(Predicate predicate)
+    {
+        this->erase(std::remove_if(this->begin(), this->end(), predicate), this->end());
+    }
+
+    template<typename Compare>
+    void sort(Compare compare)
+    {
+        std::stable_sort(this->begin(), this->end(), compare);
+    }
+
+    void reverse() { std::reverse(this->begin(), this->end()); }
+
+    operator std::vector<SyntaxType>() const
+    {
+        std::vector<SyntaxType> syntaxes;
+        syntaxes.reserve(this->size());
+        for (const auto& sql : *this) {
+            syntaxes.push_back(sql.syntax());
         }
-        return *iter;
+        return syntaxes;
     }
 
     StringView getDescription() const
     {
-        std::ostringstream stream;
+        std::string description;
         bool comma = false;
         for (const auto& sql : *this) {
             if (comma) {
-                stream << ", ";
+                description.append(", ");
             } else {
                 comma = true;
             }
-            stream << sql.getDescription();
+            StringView sqlDescription = sql.getDescription();
+            description.append(sqlDescription.data(), sqlDescription.length());
         }
-        return StringView(stream.str());
+        return StringView(std::move(description));
     }
 };
 
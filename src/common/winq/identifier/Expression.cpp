@@ -28,6 +28,14 @@ namespace WCDB {
 
 Expression::Expression() = default;
 
+Expression::Expression(const Expression& other) = default;
+
+Expression::Expression(Expression&& other) noexcept = default;
+
+Expression& Expression::operator=(const Expression& other) = default;
+
+Expression& Expression::operator=(Expression&& other) noexcept = default;
+
 Expression::~Expression() = default;
 
 Expression::Expression(const LiteralValue& literalValue)
@@ -42,6 +42,10 @@ class WCDB_API Expression final : public SpecifiedSyntax<Syntax::Expression, SQL
                                   public FTSFunctionOperable {
 public:
     using SpecifiedSyntax<Syntax::Expression, SQL>::SpecifiedSyntax;
+    Expression(const Expression& other);
+    Expression(Expression&& other) noexcept;
+    Expression& operator=(const Expression& other);
+    Expression& operator=(Expression&& other) noexcept;
     ~Expression() override;
 
     template<typename T, typename Enable = typename std::enable_if<ExpressionConvertible<T>::value>::type>
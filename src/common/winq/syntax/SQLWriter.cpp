@@ -0,0 +1,220 @@
+//
+// Created by qiuwenchen on 2026/10/16.
+//
+
+/*
+ * Tencent is pleased to support the open source community by making
+ * WCDB available.
+ *
+ * Copyright (C) 2017 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the BSD 3-Clause License (the "License"); you may not use
+ * this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *       https://opensource.org/licenses/BSD-3-Clause
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SQLWriter.hpp"
+#include "Assertion.hpp"
+#include "SyntaxIdentifier.hpp"
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace WCDB {
+
+namespace Syntax {
+
+// Avoid holding the memory of a huge SQL for the whole lifetime of thread.
+static constexpr const size_t maxReservedCapacity = 16 * 1024;
+
+#pragma mark - Stream
+class SQLStream final : private std::streambuf, public std::ostream {
+public:
+    using int_type = std::streambuf::int_type;
+    using traits_type = std::streambuf::traits_type;
+
+    SQLStream()
+    : std::streambuf()
+    , std::ostream(this)
+    , m_defaultFlags(flags())
+    , m_defaultPrecision(precision())
+    , m_defaultFill(fill())
+    {
+    }
+
+    ~SQLStream() override = default;
+
+    void reset()
+    {
+        m_buffer.clear();
+        std::ostream::clear();
+        flags(m_defaultFlags);
+        precision(m_defaultPrecision);
+        fill(m_defaultFill);
+        width(0);
+    }
+
+    void shrinkIfNeeded()
+    {
+        if (m_buffer.capacity() > maxReservedCapacity) {
+            std::string().swap(m_buffer);
+        }
+    }
+
+    UnsafeStringView written() const
+    {
+        return UnsafeStringView(m_buffer.data(), m_buffer.length());
+    }
+
+protected:
+    int_type overflow(int_type c) override final
+    {
+        if (!traits_type::eq_int_type(c, traits_type::eof())) {
+            m_buffer.push_back(traits_type::to_char_type(c));
+        }
+        return traits_type::not_eof(c);
+    }
+
+    std::streamsize xsputn(const char* s, std::streamsize n) override final
+    {
+        m_buffer.append(s, (size_t) n);
+        return n;
+    }
+
+private:
+    std::string m_buffer;
+    const std::ios_base::fmtflags m_defaultFlags;
+    const std::streamsize m_defaultPrecision;
+    const char m_defaultFill;
+};
+
+#pragma mark - Pool
+namespace {
+
+struct SQLStreamPool {
+    std::vector<std::unique_ptr<SQLStream>> streams;
+    size_t numberOfBorrowed = 0;
+};
+
+SQLStreamPool& threadedSQLStreamPool()
+{
+    thread_local SQLStreamPool s_pool;
+    return s_pool;
+}
+
+} // namespace
+
+#pragma mark - Writer
+SQLWriter::SQLWriter()
+{
+    SQLStreamPool& pool = threadedSQLStreamPool();
+    if (pool.numberOfBorrowed == pool.streams.size()) {
+        pool.streams.emplace_back(new SQLStream());
+    }
+    m_stream = pool.streams[pool.numberOfBorrowed++].get();
+    m_stream->reset();
+}
+
+SQLWriter::~SQLWriter()
+{
+    SQLStreamPool& pool = threadedSQLStreamPool();
+    WCTAssert(pool.numberOfBorrowed > 0);
+    WCTAssert(pool.streams[pool.numberOfBorrowed - 1].get() == m_stream);
+    m_stream->shrinkIfNeeded();
+    --pool.numberOfBorrowed;
+}
+
+std::ostream& SQLWriter::stream()
+{
+    return *m_stream;
+}
+
+UnsafeStringView SQLWriter::written() const
+{
+    return m_stream->written();
+}
+
+StringView SQLWriter::getDescription() const
+{
+    UnsafeStringView written = m_stream->written();
+    return StringView(written.data(), written.length());
+}
+
+#pragma mark - Fingerprint
+namespace {
+
+struct FingerprintBufferPool {
+    std::vector<std::unique_ptr<std::string>> buffers;
+    size_t numberOfBorrowed = 0;
+};
+
+FingerprintBufferPool& threadedFingerprintBufferPool()
+{
+    thread_local FingerprintBufferPool s_pool;
+    return s_pool;
+}
+
+} // namespace
+
+FingerprintWriter::FingerprintWriter() : m_length(0)
+{
+    FingerprintBufferPool& pool = threadedFingerprintBufferPool();
+    if (pool.numberOfBorrowed == pool.buffers.size()) {
+        pool.buffers.emplace_back(new std::string());
+    }
+    m_buffer = pool.buffers[pool.numberOfBorrowed++].get();
+}
+
+FingerprintWriter::~FingerprintWriter()
+{
+    FingerprintBufferPool& pool = threadedFingerprintBufferPool();
+    WCTAssert(pool.numberOfBorrowed > 0);
+    WCTAssert(pool.buffers[pool.numberOfBorrowed - 1].get() == m_buffer);
+    if (m_buffer->size() > maxReservedCapacity) {
+        std::string().swap(*m_buffer);
+    }
+    --pool.numberOfBorrowed;
+}
+
+void FingerprintWriter::writeTree(const Identifier& root)
+{
+    writeValue(root.getType());
+    write(root);
+}
+
+void FingerprintWriter::write(const Identifier& identifier)
+{
+    identifier.writeFingerprint(*this);
+}
+
+void FingerprintWriter::writeDescription(const Identifier& identifier)
+{
+    SQLWriter writer;
+    identifier.describle(writer.stream());
+    write(writer.written());
+}
+
+void FingerprintWriter::reserve(size_t capacity)
+{
+    // The whole buffer is used as the written area, so that no terminator or size needs to be maintained per part.
+    m_buffer->resize(std::max<size_t>({ capacity, 2 * m_buffer->size(), 256 }));
+}
+
+UnsafeStringView FingerprintWriter::written() const
+{
+    return UnsafeStringView(m_buffer->data(), m_length);
+}
+
+} // namespace Syntax
+
+} // namespace WCDB
@@ -0,0 +1,156 @@
+//
+// Created by qiuwenchen on 2026/10/16.
+//
+
+/*
+ * Tencent is pleased to support the open source community by making
+ * WCDB available.
+ *
+ * Copyright (C) 2017 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the BSD 3-Clause License (the "License"); you may not use
+ * this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *       https://opensource.org/licenses/BSD-3-Clause
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "StringView.hpp"
+#include "WCDBOptional.hpp"
+#include <cstring>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace WCDB {
+
+namespace Syntax {
+
+class Identifier;
+class SQLStream;
+
+// SQLWriter borrows a stream of current thread to describe the SQL.
+// Streams and their buffers are reused by the later writers of the same thread, so that
+// generating SQL constructs neither an ostringstream with its locale nor a temporary string.
+// Writers can be nested, e.g. describing a list of SQLs with their own descriptions.
+class SQLWriter final {
+public:
+    SQLWriter();
+    ~SQLWriter();
+
+    SQLWriter(const SQLWriter&) = delete;
+    SQLWriter& operator=(const SQLWriter&) = delete;
+
+    std::ostream& stream();
+
+    // It's only valid during the lifetime of writer.
+    UnsafeStringView written() const;
+    StringView getDescription() const;
+
+private:
+    SQLStream* m_stream;
+};
+
+// FingerprintWriter borrows a buffer of current thread to write the fingerprint of a syntax tree,
+// which is a compact binary encoding of its structure without keywords, formatting or escaping.
+// Syntax trees with the same fingerprint have the same description, but not vice versa.
+// Each part is either fixed-size or prefixed by its size, so that the encoding can't be ambiguous.
+class FingerprintWriter final {
+public:
+    FingerprintWriter();
+    ~FingerprintWriter();
+
+    FingerprintWriter(const FingerprintWriter&) = delete;
+    FingerprintWriter& operator=(const FingerprintWriter&) = delete;
+
+    // The type of root is written, so that the trees of different types can't be mixed up.
+    // The types of its descendants are already known from the fields they belong to.
+    void writeTree(const Identifier& root);
+    void write(const Identifier& identifier);
+    // The description of identifier, for the syntax that is not worth encoding structurally.
+    void writeDescription(const Identifier& identifier);
+
+    void write(const UnsafeStringView& string)
+    {
+        writeSize(string.length());
+        append(string.data(), string.length());
+    }
+
+    // Sizes are mostly tiny, so that they are written in 7-bit groups with the highest bit as continuation.
+    void writeSize(size_t size)
+    {
+        while (size >= 0x80) {
+            writeValue(static_cast<unsigned char>(size | 0x80));
+            size >>= 7;
+        }
+        writeValue(static_cast<unsigned char>(size));
+    }
+
+    template<typename T>
+    void writeValue(const T& value)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "");
+        append(&value, sizeof(T));
+    }
+
+    template<typename T>
+    void write(const Optional<T>& identifier)
+    {
+        writeValue(identifier.hasValue());
+        if (identifier.hasValue()) {
+            write(identifier.value());
+        }
+    }
+
+    // For the optional identifier that is described only when it's valid.
+    template<typename T>
+    void writeIfValid(const Optional<T>& identifier)
+    {
+        bool valid = identifier.hasValue() && identifier.value().isValid();
+        writeValue(valid);
+        if (valid) {
+            write(identifier.value());
+        }
+    }
+
+    template<typename T>
+    void write(const std::vector<T>& identifiers)
+    {
+        writeSize(identifiers.size());
+        for (const auto& identifier : identifiers) {
+            write(identifier);
+        }
+    }
+
+    // It's only valid during the lifetime of writer.
+    UnsafeStringView written() const;
+
+private:
+    // Most of the parts are tiny, so that they are copied inline instead of appended to string one by one.
+    void append(const void* data, size_t length)
+    {
+        if (m_length + length > m_buffer->size()) {
+            reserve(m_length + length);
+        }
+        memcpy(&(*m_buffer)[0] + m_length, data, length);
+        m_length += length;
+    }
+    void reserve(size_t capacity);
+
+    std::string* m_buffer;
+    size_t m_length;
+};
+
+} // namespace Syntax
+
+} // namespace WCDB
@@ -22,6 +22,7 @@
  * limitations under the License.
  */
 
+#include "SQLWriter.hpp"
 #include "Syntax.h"
 #include "SyntaxAssertion.hpp"
 #include "SyntaxEnum.hpp"
@@ -71,6 +72,21 @@ bool BindParameter::describle(std::ostream& stream) const
     return true;
 }
 
+void BindParameter::writeFingerprint(FingerprintWriter& writer) const
+{
+    writer.writeValue(switcher);
+    switch (switcher) {
+    case Switch::QuestionSign:
+        writer.writeValue(n);
+        break;
+    case Switch::ColonSign:
+    case Switch::AtSign:
+    case Switch::DollarSign:
+        writer.write(name);
+        break;
+    }
+}
+
 } // namespace Syntax
 
 } // namespace WCDB
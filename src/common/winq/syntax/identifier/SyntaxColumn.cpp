@@ -22,6 +22,7 @@
  * limitations under the License.
  */
 
+#include "SQLWriter.hpp"
 #include "Syntax.h"
 #include "SyntaxAssertion.hpp"
 
@@ -68,6 +69,14 @@ bool Column::describle(std::ostream& stream) const
     return true;
 }
 
+void Column::writeFingerprint(FingerprintWriter& writer) const
+{
+    writer.write(schema);
+    writer.write(table);
+    writer.writeValue(wildcard);
+    writer.write(name);
+}
+
 void Column::iterate(const Iterator& iterator, bool& stop)
 {
     Identifier::iterate(iterator, true, stop);
@@ -38,7 +38,7 @@ public:
 
     Optional<Column> column;
     WCDB_SYNTAX_ENUM_UNION(ColumnType, columnType);
-    std::list<ColumnConstraint> constraints;
+    std::vector<ColumnConstraint> constraints;
 
     bool isValid() const override final;
 
@@ -36,7 +36,7 @@ public:
     ~CommonTableExpression() override;
 
     StringView table;
-    std::list<Column> columns;
+    std::vector<Column> columns;
     Shadow<SelectSTMT> select;
 
     bool isValid() const override final;
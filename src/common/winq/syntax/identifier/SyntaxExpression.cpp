@@ -22,6 +22,7 @@
  * limitations under the License.
  */
 
+#include "SQLWriter.hpp"
 #include "Syntax.h"
 #include "SyntaxAssertion.hpp"
 #include "SyntaxEnum.hpp"
@@ -264,7 +265,7 @@ ExpressionUnionMember::ExpressionUnionMember(const ExpressionUnionMember& other)
     assignFromOther(other);
 }
 
-ExpressionUnionMember::ExpressionUnionMember(ExpressionUnionMember&& other)
+ExpressionUnionMember::ExpressionUnionMember(ExpressionUnionMember&& other) noexcept
 {
     assignFromOther(std::move(other));
 }
@@ -278,7 +279,7 @@ ExpressionUnionMember& ExpressionUnionMember::operator=(const ExpressionUnionMem
     return *this;
 }
 
-ExpressionUnionMember& ExpressionUnionMember::operator=(ExpressionUnionMember&& other)
+ExpressionUnionMember& ExpressionUnionMember::operator=(ExpressionUnionMember&& other) noexcept
 {
     firstMemberReset();
     secondMemberReset();
@@ -301,6 +302,16 @@ WCDB_SYNTAX_UNION_MEMBER_IMPLEMENT(ExpressionUnionMember, thirdMember, StringVie
 WCDB_SYNTAX_UNION_MEMBER_IMPLEMENT(ExpressionUnionMember, thirdMember, StringView, function)
 
 #pragma mark - Identifier
+Expression::Expression() = default;
+
+Expression::Expression(const Expression& other) = default;
+
+Expression::Expression(Expression&& other) noexcept = default;
+
+Expression& Expression::operator=(const Expression& other) = default;
+
+Expression& Expression::operator=(Expression&& other) noexcept = default;
+
 Expression::~Expression() = default;
 
 Identifier::Type Expression::getType() const
@@ -589,6 +600,91 @@ bool Expression::describle(std::ostream& stream) const
     return true;
 }
 
+void Expression::writeFingerprint(FingerprintWriter& writer) const
+{
+    writer.writeValue(switcher);
+    switch (switcher) {
+    case Switch::LiteralValue:
+        writer.write(literalValue());
+        break;
+    case Switch::BindParameter:
+        writer.write(bindParameter());
+        break;
+    case Switch::Column:
+        writer.write(column());
+        break;
+    case Switch::UnaryOperation:
+        writer.writeValue(unaryOperator);
+        writer.writeValue(isNot);
+        writer.write(expressions);
+        break;
+    case Switch::BinaryOperation:
+        writer.writeValue(binaryOperator);
+        writer.writeValue(isNot);
+        writer.writeValue(escape);
+        writer.write(expressions);
+        break;
+    case Switch::Function:
+        writer.write(function());
+        writer.writeValue(distinct);
+        writer.writeValue(useWildcard);
+        writer.write(expressions);
+        break;
+    case Switch::Expressions:
+        writer.write(expressions);
+        break;
+    case Switch::Cast:
+        writer.writeValue(castType);
+        writer.write(expressions);
+        break;
+    case Switch::Collate:
+        writer.write(collation());
+        writer.write(expressions);
+        break;
+    case Switch::Between:
+        writer.writeValue(isNot);
+        writer.write(expressions);
+        break;
+    case Switch::In:
+        writer.writeValue(isNot);
+        writer.writeValue(inSwitcher);
+        writer.write(expressions);
+        switch (inSwitcher) {
+        case SwitchIn::Empty:
+        case SwitchIn::Expressions:
+            break;
+        case SwitchIn::Select:
+            writer.writeValue(select() != nullptr);
+            if (select() != nullptr) {
+                writer.write(*select().get());
+            }
+            break;
+        case SwitchIn::Table:
+            writer.write(schema());
+            writer.write(table());
+            break;
+        case SwitchIn::Function:
+            writer.write(schema());
+            writer.write(function());
+            break;
+        }
+        break;
+    case Switch::Exists:
+    case Switch::Select:
+        writer.writeValue(isNot);
+        writer.writeValue(select() != nullptr);
+        if (select() != nullptr) {
+            writer.write(*select().get());
+        }
+        break;
+    case Switch::Case:
+    case Switch::RaiseFunction:
+    case Switch::Window:
+        writer.writeDescription(*this);
+        break;
+    }
+}
+
 void Expression::iterate(const Iterator& iterator, bool& stop)
 {
     Identifier::iterate(iterator, true, stop);
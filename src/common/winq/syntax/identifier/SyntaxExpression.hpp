@@ -43,9 +43,9 @@ public:
     ExpressionUnionMember();
     ~ExpressionUnionMember();
     ExpressionUnionMember(const ExpressionUnionMember& other);
-    ExpressionUnionMember(ExpressionUnionMember&& other);
+    ExpressionUnionMember(ExpressionUnionMember&& other) noexcept;
     ExpressionUnionMember& operator=(const ExpressionUnionMember& other);
-    ExpressionUnionMember& operator=(ExpressionUnionMember&& other);
+    ExpressionUnionMember& operator=(ExpressionUnionMember&& other) noexcept;
 
     LiteralValue& literalValue();
     BindParameter& bindParameter();
@@ -124,9 +124,15 @@ protected:
 
 class WCDB_API Expression final : public Identifier, public ExpressionUnionMember {
 public:
+    Expression();
+    Expression(const Expression& other);
+    // Noexcept, so that a growing vector of expressions moves them instead of copying.
+    Expression(Expression&& other) noexcept;
+    Expression& operator=(const Expression& other);
+    Expression& operator=(Expression&& other) noexcept;
     ~Expression() override;
 
-    std::list<Expression> expressions;
+    std::vector<Expression> expressions;
 
     WCDB_SYNTAX_MAIN_UNION_ENUM(LiteralValue,
                                 BindParameter,
@@ -203,6 +209,7 @@ public:
     static constexpr const Type type = Type::Expression;
     Type getType() const override final;
     bool describle(std::ostream& stream) const override final;
+    void writeFingerprint(FingerprintWriter& writer) const override final;
     void iterate(const Iterator& iterator, bool& stop) override final;
 };
 
@@ -36,7 +36,7 @@ public:
     ~ForeignKeyClause() override;
 
     StringView foreignTable;
-    std::list<Column> columns;
+    std::vector<Column> columns;
     enum class Switch : signed char {
         OnDeleteSetNull = 1,
         OnDeleteSetDefault,
@@ -49,7 +49,7 @@ public:
         OnUpdateRestrict,
         OnUpdateNoAction,
     };
-    std::list<Switch> switchers;
+    std::vector<Switch> switchers;
     WCDB_SYNTAX_ENUM_UNION(MatchType, matchType);
 
     WCDB_SYNTAX_UNION_ENUM(Deferrable,
@@ -22,6 +22,7 @@
  * limitations under the License.
  */
 
+#include "SQLWriter.hpp"
 #include "Syntax.h"
 #include "SyntaxAssertion.hpp"
 
@@ -34,15 +35,20 @@ Identifier::~Identifier() = default;
 StringView Identifier::getDescription() const
 {
     if (isValid()) {
-        std::ostringstream stream;
-        if (describle(stream)) {
-            return stream.str();
+        SQLWriter writer;
+        if (describle(writer.stream())) {
+            return writer.getDescription();
         }
         WCTAssert(false);
     }
     return StringView();
 }
 
+void Identifier::writeFingerprint(FingerprintWriter &writer) const
+{
+    writer.writeDescription(*this);
+}
+
 void Identifier::iterate(const Iterator &iterator)
 {
     if (isValid()) {
@@ -32,11 +32,14 @@
 #include <functional>
 #include <list>
 #include <sstream>
+#include <vector>
 
 namespace WCDB {
 
 namespace Syntax {
 
+class FingerprintWriter;
+
 class WCDB_API Identifier : public Cloneable<Identifier> {
 public:
     virtual ~Identifier() override = 0;
@@ -108,6 +111,10 @@ public:
 
     virtual bool describle(std::ostream& stream) const = 0;
 
+    // Identifiers with the same fingerprint are described the same.
+    // It's the description itself by default, and the syntax looked up frequently encodes its structure instead.
+    virtual void writeFingerprint(FingerprintWriter& writer) const;
+
 #pragma mark - Iterable
 public:
     typedef std::function<void(Identifier&, bool isBegin, bool& stop)> Iterator;
@@ -124,7 +131,7 @@ protected:
 
     template<typename T, typename Enable = typename std::enable_if<std::is_base_of<Identifier, T>::value>>
     static void
-    listIterate(std::list<T>& identifiers, const Iterator& iterator, bool& stop)
+    listIterate(std::vector<T>& identifiers, const Iterator& iterator, bool& stop)
     {
         if (!stop) {
             for (auto& identifier : identifiers) {
@@ -142,7 +149,7 @@ protected:
 std::ostream& operator<<(std::ostream& stream, const WCDB::Syntax::Identifier& identifiers);
 
 template<typename T, typename Enable = typename std::enable_if<std::is_base_of<WCDB::Syntax::Identifier, T>::value>::type>
-std::ostream& operator<<(std::ostream& stream, const std::list<T>& identifiers)
+std::ostream& operator<<(std::ostream& stream, const std::vector<T>& identifiers)
 {
     bool comma = false;
     for (const auto& identifier : identifiers) {
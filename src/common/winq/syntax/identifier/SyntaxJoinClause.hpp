@@ -38,9 +38,9 @@ class WCDB_API JoinClause final : public Identifier {
 public:
     ~JoinClause() override;
 
-    std::list<JoinOperator> joinOperators;
-    std::list<TableOrSubquery> tableOrSubqueries;
-    std::list<Shadow<JoinConstraint>> joinConstraints; // nullable
+    std::vector<JoinOperator> joinOperators;
+    std::vector<TableOrSubquery> tableOrSubqueries;
+    std::vector<Shadow<JoinConstraint>> joinConstraints; // nullable
 
     bool isValid() const override final;
 
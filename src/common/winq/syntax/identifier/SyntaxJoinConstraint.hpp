@@ -36,7 +36,7 @@ public:
     ~JoinConstraint() override;
 
     Optional<Expression> expression;
-    std::list<Column> columns;
+    std::vector<Column> columns;
     bool isValid() const override final;
 
 #pragma mark - Identifier
@@ -22,6 +22,7 @@
  * limitations under the License.
  */
 
+#include "SQLWriter.hpp"
 #include "Syntax.h"
 #include "SyntaxAssertion.hpp"
 #include <limits>
@@ -82,6 +83,33 @@ bool LiteralValue::describle(std::ostream& stream) const
     return true;
 }
 
+void LiteralValue::writeFingerprint(FingerprintWriter& writer) const
+{
+    writer.writeValue(switcher);
+    switch (switcher) {
+    case Switch::StringView:
+        writer.write(stringValue);
+        break;
+    case Switch::Float:
+        writer.writeValue(floatValue);
+        break;
+    case Switch::Integer:
+        writer.writeValue(integerValue);
+        break;
+    case Switch::UnsignedInteger:
+        writer.writeValue(unsignedIntegerValue);
+        break;
+    case Switch::Bool:
+        writer.writeValue(boolValue);
+        break;
+    case Switch::Null:
+    case Switch::CurrentTime:
+    case Switch::CurrentDate:
+    case Switch::CurrentTimestamp:
+        break;
+    }
+}
+
 } // namespace Syntax
 
 } // namespace WCDB
@@ -52,6 +52,7 @@ public:
     static constexpr const Type type = Type::LiteralValue;
     Type getType() const override final;
     bool describle(std::ostream& stream) const override final;
+    void writeFingerprint(FingerprintWriter& writer) const override final;
 };
 
 } // namespace Syntax
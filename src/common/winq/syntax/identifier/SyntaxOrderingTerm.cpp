@@ -22,6 +22,7 @@
  * limitations under the License.
  */
 
+#include "SQLWriter.hpp"
 #include "Syntax.h"
 #include "SyntaxAssertion.hpp"
 #include "SyntaxEnum.hpp"
@@ -55,6 +56,16 @@ bool OrderingTerm::describle(std::ostream& stream) const
     return true;
 }
 
+void OrderingTerm::writeFingerprint(FingerprintWriter& writer) const
+{
+    writer.write(expression);
+    writer.write(collation);
+    writer.writeValue(orderValid());
+    if (orderValid()) {
+        writer.writeValue(order);
+    }
+}
+
 void OrderingTerm::iterate(const Iterator& iterator, bool& stop)
 {
     Identifier::iterate(iterator, true, stop);
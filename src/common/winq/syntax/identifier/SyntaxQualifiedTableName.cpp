@@ -22,6 +22,7 @@
  * limitations under the License.
  */
 
+#include "SQLWriter.hpp"
 #include "Syntax.h"
 #include "SyntaxAssertion.hpp"
 
@@ -69,6 +70,17 @@ bool QualifiedTableName::describle(std::ostream& stream, bool skipSchema) const
     return true;
 }
 
+void QualifiedTableName::writeFingerprint(FingerprintWriter& writer) const
+{
+    writer.write(schema);
+    writer.write(table);
+    writer.write(alias);
+    writer.writeValue(switcher);
+    if (switcher == Switch::Indexed) {
+        writer.write(index);
+    }
+}
+
 void QualifiedTableName::iterate(const Iterator& iterator, bool& stop)
 {
     Identifier::iterate(iterator, true, stop);
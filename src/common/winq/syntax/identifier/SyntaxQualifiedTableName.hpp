@@ -53,6 +53,7 @@ public:
     static constexpr const Type type = Type::QualifiedTableName;
     Type getType() const override final;
     bool describle(std::ostream& stream) const override final;
+    void writeFingerprint(FingerprintWriter& writer) const override final;
     bool describle(std::ostream& stream, bool skipSchema) const;
     void iterate(const Iterator& iterator, bool& stop) override final;
 
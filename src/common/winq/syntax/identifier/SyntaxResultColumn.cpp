@@ -22,6 +22,7 @@
  * limitations under the License.
  */
 
+#include "SQLWriter.hpp"
 #include "Syntax.h"
 #include "SyntaxAssertion.hpp"
 
@@ -51,6 +52,12 @@ bool ResultColumn::describle(std::ostream& stream) const
     return true;
 }
 
+void ResultColumn::writeFingerprint(FingerprintWriter& writer) const
+{
+    writer.write(expression);
+    writer.write(alias);
+}
+
 void ResultColumn::iterate(const Iterator& iterator, bool& stop)
 {
     Identifier::iterate(iterator, true, stop);
@@ -45,6 +45,7 @@ public:
     static constexpr const Type type = Type::ResultColumn;
     Type getType() const override final;
     bool describle(std::ostream& stream) const override final;
+    void writeFingerprint(FingerprintWriter& writer) const override final;
     void iterate(const Iterator& iterator, bool& stop) override final;
 };
 
@@ -22,6 +22,7 @@
  * limitations under the License.
  */
 
+#include "SQLWriter.hpp"
 #include "Syntax.h"
 #include "SyntaxAssertion.hpp"
 
@@ -52,6 +53,11 @@ bool Schema::describle(std::ostream& stream) const
     return true;
 }
 
+void Schema::writeFingerprint(FingerprintWriter& writer) const
+{
+    writer.write(name);
+}
+
 bool Schema::isMain() const
 {
     return name.empty() || name == mainSchema;
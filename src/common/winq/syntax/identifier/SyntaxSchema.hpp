@@ -45,6 +45,7 @@ public:
     static constexpr const Type type = Type::Schema;
     Type getType() const override final;
     bool describle(std::ostream& stream) const override final;
+    void writeFingerprint(FingerprintWriter& writer) const override final;
 
 #pragma mark - Utility
 public:
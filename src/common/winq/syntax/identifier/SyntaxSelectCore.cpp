@@ -22,6 +22,7 @@
  * limitations under the License.
  */
 
+#include "SQLWriter.hpp"
 #include "Syntax.h"
 #include "SyntaxAssertion.hpp"
 
@@ -97,6 +98,34 @@ bool SelectCore::describle(std::ostream& stream) const
     return true;
 }
 
+void SelectCore::writeFingerprint(FingerprintWriter& writer) const
+{
+    writer.writeValue(switcher);
+    switch (switcher) {
+    case Switch::Select:
+        // Named windows are rarely used.
+        writer.writeValue(windows.empty());
+        if (!windows.empty()) {
+            writer.writeDescription(*this);
+            break;
+        }
+        writer.writeValue(distinct);
+        writer.write(resultColumns);
+        writer.write(tableOrSubqueries);
+        writer.writeIfValid(joinClause);
+        writer.writeIfValid(condition);
+        writer.write(groups);
+        writer.writeIfValid(having);
+        break;
+    case Switch::Values:
+        writer.writeSize(valuesList.size());
+        for (const auto& values : valuesList) {
+            writer.write(values);
+        }
+        break;
+    }
+}
+
 void SelectCore::iterate(const Iterator& iterator, bool& stop)
 {
     Identifier::iterate(iterator, true, stop);
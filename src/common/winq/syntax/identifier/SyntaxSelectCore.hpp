@@ -41,22 +41,23 @@ public:
 
     WCDB_SYNTAX_MAIN_UNION_ENUM(Select, Values, );
     bool distinct = false;
-    std::list<ResultColumn> resultColumns;
-    std::list<TableOrSubquery> tableOrSubqueries;
+    std::vector<ResultColumn> resultColumns;
+    std::vector<TableOrSubquery> tableOrSubqueries;
     Optional<JoinClause> joinClause;
     Optional<Expression> condition;
-    std::list<Expression> groups;
+    std::vector<Expression> groups;
     Optional<Expression> having;
-    std::list<StringView> windows;
-    std::list<WindowDef> windowDefs;
+    std::vector<StringView> windows;
+    std::vector<WindowDef> windowDefs;
 
-    std::list<std::list<Expression>> valuesList;
+    std::vector<std::vector<Expression>> valuesList;
 
 #pragma mark - Identifier
 public:
     static constexpr const Type type = Type::SelectCore;
     Type getType() const override final;
     bool describle(std::ostream& stream) const override final;
+    void writeFingerprint(FingerprintWriter& writer) const override final;
     void iterate(const Iterator& iterator, bool& stop) override final;
 };
 
@@ -42,12 +42,12 @@ public:
     StringView name;
     WCDB_SYNTAX_MAIN_UNION_ENUM(PrimaryKey, Unique, Check, ForeignKey, );
 
-    std::list<IndexedColumn> indexedColumns;
+    std::vector<IndexedColumn> indexedColumns;
     WCDB_SYNTAX_ENUM_UNION(Conflict, conflict);
 
     Optional<Expression> expression;
 
-    std::list<Column> columns;
+    std::vector<Column> columns;
     Optional<ForeignKeyClause> foreignKeyClause;
 
 #pragma mark - Identifier
@@ -22,6 +22,7 @@
  * limitations under the License.
  */
 
+#include "SQLWriter.hpp"
 #include "Syntax.h"
 #include "SyntaxAssertion.hpp"
 
@@ -84,6 +85,33 @@ bool TableOrSubquery::describle(std::ostream& stream) const
     return true;
 }
 
+void TableOrSubquery::writeFingerprint(FingerprintWriter& writer) const
+{
+    writer.writeValue(switcher);
+    switch (switcher) {
+    case Switch::Table:
+        writer.write(schema);
+        writer.write(tableOrFunction);
+        writer.write(alias);
+        writer.writeValue(indexType);
+        if (indexType == IndexType::Indexed) {
+            writer.write(index);
+        }
+        break;
+    case Switch::Function:
+        writer.write(schema);
+        writer.write(tableOrFunction);
+        writer.write(expressions);
+        writer.write(alias);
+        break;
+    case Switch::TableOrSubqueries:
+    case Switch::JoinClause:
+    case Switch::Select:
+        writer.writeDescription(*this);
+        break;
+    }
+}
+
 void TableOrSubquery::iterate(const Iterator& iterator, bool& stop)
 {
     Identifier::iterate(iterator, true, stop);
@@ -49,8 +49,8 @@ public:
     } indexType
     = IndexType::NotSet;
     StringView index;
-    std::list<Expression> expressions;
-    std::list<TableOrSubquery> tableOrSubqueries;
+    std::vector<Expression> expressions;
+    std::vector<TableOrSubquery> tableOrSubqueries;
     Shadow<JoinClause> joinClause;
     Shadow<SelectSTMT> select;
 
@@ -59,6 +59,7 @@ public:
     static constexpr const Type type = Type::TableOrSubquery;
     Type getType() const override final;
     bool describle(std::ostream& stream) const override final;
+    void writeFingerprint(FingerprintWriter& writer) const override final;
     void iterate(const Iterator& iterator, bool& stop) override final;
 };
 
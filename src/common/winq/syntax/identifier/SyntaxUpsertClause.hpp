@@ -35,11 +35,11 @@ class WCDB_API UpsertClause final : public Identifier {
 public:
     ~UpsertClause() override;
 
-    std::list<IndexedColumn> indexedColumns;
+    std::vector<IndexedColumn> indexedColumns;
     Shadow<Expression> condition;
     WCDB_SYNTAX_MAIN_UNION_ENUM(Nothing, Update);
-    std::list<std::list<Column>> columnsList;
-    std::list<Expression> expressions;
+    std::vector<std::vector<Column>> columnsList;
+    std::vector<Expression> expressions;
     Shadow<Expression> updateCondition;
 
 #pragma mark - Identifier
@@ -39,8 +39,8 @@ class WCDB_API WindowDef final : public Identifier {
 public:
     ~WindowDef() override;
 
-    std::list<Expression> expressions;
-    std::list<OrderingTerm> orderingTerms;
+    std::vector<Expression> expressions;
+    std::vector<OrderingTerm> orderingTerms;
     Optional<FrameSpec> frameSpec;
 
     bool isValid() const override final;
@@ -41,7 +41,7 @@ public:
     Schema schema;
     StringView index;
     StringView table;
-    std::list<IndexedColumn> indexedColumns;
+    std::vector<IndexedColumn> indexedColumns;
     Optional<Expression> condition;
 
     bool isValid() const override final;
@@ -44,8 +44,8 @@ public:
     Schema schema;
     StringView table;
     WCDB_SYNTAX_MAIN_UNION_ENUM(ColumnDefs, Select, );
-    std::list<ColumnDef> columnDefs;
-    std::list<TableConstraint> tableConstraints;
+    std::vector<ColumnDef> columnDefs;
+    std::vector<TableConstraint> tableConstraints;
     bool withoutRowid = false;
 
     Optional<SelectSTMT> select;
@@ -55,7 +55,7 @@ public:
         Insert,
         Update,
     } event;
-    std::list<Column> columns;
+    std::vector<Column> columns;
     StringView table;
     bool forEachFow = false;
     Optional<Expression> condition;
@@ -66,11 +66,11 @@ public:
         Delete,
         Select,
     };
-    std::list<STMT> stmts;
-    std::list<InsertSTMT> inserts;
-    std::list<SelectSTMT> selects;
-    std::list<UpdateSTMT> updates;
-    std::list<DeleteSTMT> deletes;
+    std::vector<STMT> stmts;
+    std::vector<InsertSTMT> inserts;
+    std::vector<SelectSTMT> selects;
+    std::vector<UpdateSTMT> updates;
+    std::vector<DeleteSTMT> deletes;
 
     bool isValid() const override final;
 
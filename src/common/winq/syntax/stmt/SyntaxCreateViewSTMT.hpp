@@ -39,7 +39,7 @@ public:
     bool ifNotExists = false;
     Schema schema;
     StringView view;
-    std::list<Column> columns;
+    std::vector<Column> columns;
     Optional<SelectSTMT> select;
 
     bool isValid() const override final;
@@ -39,7 +39,7 @@ public:
     Schema schema;
     StringView table;
     StringView module;
-    std::list<StringView> arguments;
+    std::vector<StringView> arguments;
 
     bool isValid() const override final;
 
@@ -22,6 +22,7 @@
  * limitations under the License.
  */
 
+#include "SQLWriter.hpp"
 #include "Syntax.h"
 #include "SyntaxAssertion.hpp"
 
@@ -82,6 +83,18 @@ bool DeleteSTMT::describle(std::ostream& stream, bool skipSchema) const
     return true;
 }
 
+void DeleteSTMT::writeFingerprint(FingerprintWriter& writer) const
+{
+    writer.writeValue(recursive);
+    writer.write(commonTableExpressions);
+    writer.write(table);
+    writer.writeIfValid(condition);
+    writer.write(orderingTerms);
+    writer.writeIfValid(limit);
+    writer.writeValue(limitParameterType);
+    writer.write(limitParameter);
+}
+
 void DeleteSTMT::iterate(const Iterator& iterator, bool& stop)
 {
     Identifier::iterate(iterator, true, stop);
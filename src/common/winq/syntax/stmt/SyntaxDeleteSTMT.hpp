@@ -36,10 +36,10 @@ public:
     ~DeleteSTMT() override;
 
     bool recursive = false;
-    std::list<CommonTableExpression> commonTableExpressions;
+    std::vector<CommonTableExpression> commonTableExpressions;
     QualifiedTableName table;
     Optional<Expression> condition;
-    std::list<OrderingTerm> orderingTerms;
+    std::vector<OrderingTerm> orderingTerms;
     Optional<Expression> limit;
     LimitParameterType limitParameterType = LimitParameterType::NotSet;
     Optional<Expression> limitParameter;
@@ -51,6 +51,7 @@ public:
     static constexpr const Type type = Type::DeleteSTMT;
     Type getType() const override final;
     bool describle(std::ostream& stream) const override final;
+    void writeFingerprint(FingerprintWriter& writer) const override final;
     bool describle(std::ostream& stream, bool skipSchema) const;
     void iterate(const Iterator& iterator, bool& stop) override final;
 };
@@ -22,6 +22,7 @@
  * limitations under the License.
  */
 
+#include "SQLWriter.hpp"
 #include "Syntax.h"
 #include "SyntaxAssertion.hpp"
 #include "SyntaxEnum.hpp"
@@ -95,6 +96,35 @@ bool InsertSTMT::describle(std::ostream& stream) const
     return describle(stream, false);
 }
 
+void InsertSTMT::writeFingerprint(FingerprintWriter& writer) const
+{
+    writer.writeValue(recursive);
+    writer.write(commonTableExpressions);
+    writer.writeValue(conflictActionValid());
+    if (conflictActionValid()) {
+        writer.writeValue(conflictAction);
+    }
+    writer.write(schema);
+    writer.write(table);
+    writer.write(alias);
+    writer.write(columns);
+    writer.writeValue(switcher);
+    switch (switcher) {
+    case Switch::Values:
+        writer.writeSize(expressionsValues.size());
+        for (const auto& expressionsValue : expressionsValues) {
+            writer.write(expressionsValue);
+        }
+        break;
+    case Switch::Select:
+        writer.write(select);
+        break;
+    case Switch::Default:
+        break;
+    }
+    writer.writeIfValid(upsertClause);
+}
+
 void InsertSTMT::iterate(const Iterator& iterator, bool& stop)
 {
     Identifier::iterate(iterator, true, stop);
@@ -36,16 +36,16 @@ public:
     ~InsertSTMT() override;
 
     bool recursive = false;
-    std::list<CommonTableExpression> commonTableExpressions;
+    std::vector<CommonTableExpression> commonTableExpressions;
 
     WCDB_SYNTAX_ENUM_UNION(ConflictAction, conflictAction);
     Schema schema;
     StringView table;
     StringView alias;
-    std::list<Column> columns;
+    std::vector<Column> columns;
 
     WCDB_SYNTAX_MAIN_UNION_ENUM(Values, Select, Default);
-    std::list<std::list<Expression>> expressionsValues;
+    std::vector<std::vector<Expression>> expressionsValues;
     Optional<SelectSTMT> select;
 
     Optional<UpsertClause> upsertClause;
@@ -55,6 +55,7 @@ public:
     static constexpr const Type type = Type::InsertSTMT;
     Type getType() const override final;
     bool describle(std::ostream& stream) const override final;
+    void writeFingerprint(FingerprintWriter& writer) const override final;
     bool describle(std::ostream& stream, bool skipSchema) const;
     void iterate(const Iterator& iterator, bool& stop) override final;
 
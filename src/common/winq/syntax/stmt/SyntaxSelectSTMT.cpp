@@ -22,6 +22,7 @@
  * limitations under the License.
  */
 
+#include "SQLWriter.hpp"
 #include "Syntax.h"
 #include "SyntaxAssertion.hpp"
 #include "SyntaxEnum.hpp"
@@ -82,6 +83,22 @@ bool SelectSTMT::describle(std::ostream& stream) const
     return true;
 }
 
+void SelectSTMT::writeFingerprint(FingerprintWriter& writer) const
+{
+    writer.writeValue(recursive);
+    writer.write(commonTableExpressions);
+    writer.write(select);
+    writer.write(cores);
+    writer.writeSize(compoundOperators.size());
+    for (const auto& compoundOperator : compoundOperators) {
+        writer.writeValue(compoundOperator);
+    }
+    writer.write(orderingTerms);
+    writer.writeIfValid(limit);
+    writer.writeValue(limitParameterType);
+    writer.write(limitParameter);
+}
+
 void SelectSTMT::iterate(const Iterator& iterator, bool& stop)
 {
     Identifier::iterate(iterator, true, stop);
@@ -41,13 +41,13 @@ public:
     ~SelectSTMT() override;
 
     bool recursive = false;
-    std::list<CommonTableExpression> commonTableExpressions;
+    std::vector<CommonTableExpression> commonTableExpressions;
 
     Optional<SelectCore> select;
-    std::list<SelectCore> cores;
-    std::list<CompoundOperator> compoundOperators;
+    std::vector<SelectCore> cores;
+    std::vector<CompoundOperator> compoundOperators;
 
-    std::list<OrderingTerm> orderingTerms;
+    std::vector<OrderingTerm> orderingTerms;
     Optional<Expression> limit;
     LimitParameterType limitParameterType = LimitParameterType::NotSet;
     Optional<Expression> limitParameter;
@@ -59,6 +59,7 @@ public:
     static constexpr const Type type = Type::SelectSTMT;
     Type getType() const override final;
     bool describle(std::ostream& stream) const override final;
+    void writeFingerprint(FingerprintWriter& writer) const override final;
     void iterate(const Iterator& iterator, bool& stop) override final;
 };
 
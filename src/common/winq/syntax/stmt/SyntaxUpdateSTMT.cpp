@@ -22,6 +22,7 @@
  * limitations under the License.
  */
 
+#include "SQLWriter.hpp"
 #include "Syntax.h"
 #include "SyntaxAssertion.hpp"
 #include "SyntaxEnum.hpp"
@@ -108,6 +109,27 @@ bool UpdateSTMT::describle(std::ostream& stream) const
     return describle(stream, false);
 }
 
+void UpdateSTMT::writeFingerprint(FingerprintWriter& writer) const
+{
+    writer.writeValue(recursive);
+    writer.write(commonTableExpressions);
+    writer.writeValue(conflictActionValid());
+    if (conflictActionValid()) {
+        writer.writeValue(conflictAction);
+    }
+    writer.write(table);
+    writer.writeSize(columnsList.size());
+    for (const auto& columns : columnsList) {
+        writer.write(columns);
+    }
+    writer.write(expressions);
+    writer.writeIfValid(condition);
+    writer.write(orderingTerms);
+    writer.writeIfValid(limit);
+    writer.writeValue(limitParameterType);
+    writer.write(limitParameter);
+}
+
 void UpdateSTMT::iterate(const Iterator& iterator, bool& stop)
 {
     Identifier::iterate(iterator, true, stop);
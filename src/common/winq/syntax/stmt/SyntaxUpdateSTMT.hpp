@@ -36,14 +36,14 @@ public:
     ~UpdateSTMT() override;
 
     bool recursive = false;
-    std::list<CommonTableExpression> commonTableExpressions;
+    std::vector<CommonTableExpression> commonTableExpressions;
 
     WCDB_SYNTAX_ENUM_UNION(ConflictAction, conflictAction);
     QualifiedTableName table;
-    std::list<std::list<Column>> columnsList;
-    std::list<Expression> expressions;
+    std::vector<std::vector<Column>> columnsList;
+    std::vector<Expression> expressions;
     Optional<Expression> condition;
-    std::list<OrderingTerm> orderingTerms;
+    std::vector<OrderingTerm> orderingTerms;
     Optional<Expression> limit;
     LimitParameterType limitParameterType = LimitParameterType::NotSet;
     Optional<Expression> limitParameter;
@@ -55,6 +55,7 @@ public:
     static constexpr const Type type = Type::UpdateSTMT;
     Type getType() const override final;
     bool describle(std::ostream& stream) const override final;
+    void writeFingerprint(FingerprintWriter& writer) const override final;
     bool describle(std::ostream& stream, bool skipSchema) const;
     void iterate(const Iterator& iterator, bool& stop) override final;
 };
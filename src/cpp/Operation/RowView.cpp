@@ -0,0 +1,87 @@
+//
+// Created by qiuwenchen on 2026/10/16.
+//
+
+/*
+ * Tencent is pleased to support the open source community by making
+ * WCDB available.
+ *
+ * Copyright (C) 2017 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the BSD 3-Clause License (the "License"); you may not use
+ * this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *       https://opensource.org/licenses/BSD-3-Clause
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "RowView.hpp"
+#include "HandleStatement.hpp"
+
+namespace WCDB {
+
+#define GetHandleStatementOrReturnValue(value)                                 \
+    if (m_handleStatement == nullptr) {                                        \
+        return value;                                                          \
+    }
+
+RowView::RowView(HandleStatement *handleStatement)
+: m_handleStatement(handleStatement)
+{
+}
+
+bool RowView::isValid() const
+{
+    return m_handleStatement != nullptr;
+}
+
+int RowView::getNumberOfColumns() const
+{
+    GetHandleStatementOrReturnValue(0);
+    return m_handleStatement->getNumberOfColumns();
+}
+
+ColumnType RowView::getType(int index) const
+{
+    GetHandleStatementOrReturnValue(ColumnType::Null);
+    return m_handleStatement->getType(index);
+}
+
+bool RowView::isNull(int index) const
+{
+    GetHandleStatementOrReturnValue(true);
+    return m_handleStatement->getType(index) == ColumnType::Null;
+}
+
+RowView::Integer RowView::getInteger(int index) const
+{
+    GetHandleStatementOrReturnValue(0);
+    return m_handleStatement->getInteger(index);
+}
+
+RowView::Float RowView::getDouble(int index) const
+{
+    GetHandleStatementOrReturnValue(0);
+    return m_handleStatement->getDouble(index);
+}
+
+RowView::Text RowView::getText(int index) const
+{
+    GetHandleStatementOrReturnValue(RowView::Text());
+    return m_handleStatement->getText(index);
+}
+
+const RowView::BLOB RowView::getBLOB(int index) const
+{
+    GetHandleStatementOrReturnValue(RowView::BLOB());
+    return m_handleStatement->getBLOB(index);
+}
+
+} //namespace WCDB
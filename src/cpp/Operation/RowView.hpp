@@ -0,0 +1,178 @@
+//
+// Created by qiuwenchen on 2026/10/16.
+//
+
+/*
+ * Tencent is pleased to support the open source community by making
+ * WCDB available.
+ *
+ * Copyright (C) 2017 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the BSD 3-Clause License (the "License"); you may not use
+ * this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *       https://opensource.org/licenses/BSD-3-Clause
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include "CPPDeclaration.h"
+#include <tuple>
+#include <type_traits>
+
+namespace WCDB {
+
+template<typename T, typename Enable = void>
+struct RowViewProjection;
+
+/**
+ @brief A non-owning view of the current row of a stepped statement.
+ The text and BLOB returned by `RowView` point to the memory managed by SQLite directly, so they are only valid until the next `step()`, `reset()` or `finalize()` of the statement.
+ Use `StringView`/`Data`/`std::string` projections to keep a copy of them.
+ A row view without statement is invalid, and all its columns are read as null.
+ */
+class WCDB_API RowView final {
+public:
+    RowView(HandleStatement *handleStatement);
+
+    /**
+     @brief Check whether it's a view of a statement.
+     */
+    bool isValid() const;
+
+    using Integer = ColumnTypeInfo<ColumnType::Integer>::UnderlyingType;
+    using Text = ColumnTypeInfo<ColumnType::Text>::UnderlyingType;
+    using Float = ColumnTypeInfo<ColumnType::Float>::UnderlyingType;
+    using BLOB = ColumnTypeInfo<ColumnType::BLOB>::UnderlyingType;
+
+    /**
+     @brief The wrapper of `sqlite3_column_count`.
+     */
+    int getNumberOfColumns() const;
+
+    /**
+     @brief The wrapper of `sqlite3_column_type`.
+     */
+    ColumnType getType(int index = 0) const;
+
+    bool isNull(int index = 0) const;
+
+    /**
+     @brief The wrapper of `sqlite3_column_int64`.
+     */
+    Integer getInteger(int index = 0) const;
+
+    /**
+     @brief The wrapper of `sqlite3_column_double`.
+     */
+    Float getDouble(int index = 0) const;
+
+    /**
+     @brief The wrapper of `sqlite3_column_text`. No copy is made.
+     */
+    Text getText(int index = 0) const;
+
+    /**
+     @brief The wrapper of `sqlite3_column_blob`. No copy is made.
+     */
+    const BLOB getBLOB(int index = 0) const;
+
+    /**
+     @brief Extract the value of column at index as type `T`.
+     Integral, floating point, `UnsafeStringView`, `StringView`, `std::string`, `UnsafeData` and `Data` are supported.
+     */
+    template<typename T>
+    T get(int index = 0) const
+    {
+        return RowViewProjection<T>::project(*this, index);
+    }
+
+    /**
+     @brief Extract the values of consecutive columns starting from offset as a tuple.
+     @code
+     std::tuple<int64_t, UnsafeStringView> row = rowView.getTuple<int64_t, UnsafeStringView>();
+     @endcode
+     */
+    template<typename... Types>
+    std::tuple<Types...> getTuple(int offset = 0) const
+    {
+        return getTuple<Types...>(offset, std::index_sequence_for<Types...>());
+    }
+
+private:
+    template<typename... Types, size_t... Indexes>
+    std::tuple<Types...> getTuple(int offset, std::index_sequence<Indexes...>) const
+    {
+        return std::tuple<Types...>(get<Types>(offset + (int) Indexes)...);
+    }
+
+    HandleStatement *m_handleStatement;
+};
+
+template<typename T>
+struct RowViewProjection<T, typename std::enable_if<std::is_integral<T>::value>::type> {
+    static T project(const RowView &rowView, int index)
+    {
+        return static_cast<T>(rowView.getInteger(index));
+    }
+};
+
+template<typename T>
+struct RowViewProjection<T, typename std::enable_if<std::is_floating_point<T>::value>::type> {
+    static T project(const RowView &rowView, int index)
+    {
+        return static_cast<T>(rowView.getDouble(index));
+    }
+};
+
+template<>
+struct RowViewProjection<UnsafeStringView> {
+    static UnsafeStringView project(const RowView &rowView, int index)
+    {
+        return rowView.getText(index);
+    }
+};
+
+template<>
+struct RowViewProjection<StringView> {
+    static StringView project(const RowView &rowView, int index)
+    {
+        return StringView(rowView.getText(index));
+    }
+};
+
+template<>
+struct RowViewProjection<std::string> {
+    static std::string project(const RowView &rowView, int index)
+    {
+        UnsafeStringView text = rowView.getText(index);
+        return std::string(text.data(), text.length());
+    }
+};
+
+template<>
+struct RowViewProjection<UnsafeData> {
+    static UnsafeData project(const RowView &rowView, int index)
+    {
+        return rowView.getBLOB(index);
+    }
+};
+
+template<>
+struct RowViewProjection<Data> {
+    static Data project(const RowView &rowView, int index)
+    {
+        return Data(rowView.getBLOB(index));
+    }
+};
+
+typedef std::function<bool(const RowView &)> RowViewEnumerator;
+
+} //namespace WCDB
@@ -198,6 +198,31 @@ OptionalMultiRows StatementOperation::getAllRows()
     return handleStatement->getAllRows();
 }
 
+bool StatementOperation::fetchBatch(ColumnarBatch &batch, size_t maxNumberOfRows)
+{
+    GetHandleStatementOrReturnValue(false);
+    return handleStatement->fetchBatch(batch, maxNumberOfRows);
+}
+
+RowView StatementOperation::getRowView()
+{
+    GetHandleStatementOrReturnValue(RowView(nullptr));
+    return RowView(handleStatement);
+}
+
+bool StatementOperation::enumerateRows(const RowViewEnumerator &enumerator)
+{
+    GetHandleStatementOrReturnValue(false);
+    RowView rowView(handleStatement);
+    bool succeed = false;
+    while ((succeed = handleStatement->step()) && !handleStatement->done()) {
+        if (!enumerator(rowView)) {
+            break;
+        }
+    }
+    return succeed;
+}
+
 MultiObject StatementOperation::extractOneMultiObject(const ResultFields &resultFields)
 {
     MultiObject result;
@@ -225,6 +250,33 @@ StatementOperation::extractAllMultiObjects(const ResultFields &resultFields)
     return succeed && !result.hasValue() ? ValueArray<MultiObject>() : result;
 }
 
+bool StatementOperation::enumerateMultiObjects(const ResultFields &resultFields,
+                                               const MultiObjectEnumerator &enumerator)
+{
+    bool succeed = false;
+    while ((succeed = step()) && !done()) {
+        MultiObject multiObject = extractOneMultiObject(resultFields);
+        if (!enumerator(multiObject)) {
+            break;
+        }
+    }
+    return succeed;
+}
+
+bool StatementOperation::extractMultiObjects(const ResultFields &resultFields,
+                                             ValueArray<MultiObject> &objects,
+                                             size_t maxNumberOfObjects)
+{
+    objects.clear();
+    bool succeed = true;
+    // Step again after done will restart the statement.
+    while (objects.size() < maxNumberOfObjects && !done() && (succeed = step())
+           && !done()) {
+        objects.push_back(extractOneMultiObject(resultFields));
+    }
+    return succeed;
+}
+
 const UnsafeStringView StatementOperation::getOriginColumnName(int index)
 {
     GetHandleStatementOrReturnValue(UnsafeStringView());
@@ -24,7 +24,9 @@
 
 #pragma once
 #include "CPPDeclaration.h"
+#include "ColumnarBatch.hpp"
 #include "MultiObject.hpp"
+#include "RowView.hpp"
 #include "Statement.hpp"
 #include "Value.hpp"
 
@@ -142,6 +144,11 @@ public:
     {
         WCDB_CPP_ORM_STATIC_ASSERT_FOR_OBJECT_TYPE
         const BaseAccessor* accessor = field.getAccessor();
+        BaseAccessor::StaticBinder binder = accessor->getStaticBinder();
+        if (binder != nullptr) {
+            binder(accessor, &obj, *this, index);
+            return;
+        }
         switch (accessor->getColumnType()) {
         case ColumnType::Integer: {
             auto intAccessor
@@ -257,6 +264,14 @@ public:
      */
     OneRowValue getOneRow();
 
+    /**
+     @brief Get a non-owning view of the current row.
+     Unlike `StatementOperation::getOneRow()`, no value is copied. The text and BLOB in it are only valid until the next step.
+     @return An invalid row view if there is no statement. See `RowView::isValid()`.
+     @see   `WCDB::RowView`
+     */
+    RowView getRowView();
+
     /**
      @brief Extract the values of the current row and assign them into the fields specified by resultFields of a new object.
      @return An object.
@@ -264,11 +279,29 @@ public:
     template<class ObjectType>
     ObjectType extractOneObject(const ResultFields& resultFields)
     {
-        WCDB_CPP_ORM_STATIC_ASSERT_FOR_OBJECT_TYPE
         ObjectType obj;
+        extractOneObject(obj, resultFields);
+        return obj;
+    }
+
+    /**
+     @brief Extract the values of the current row and assign them into the fields specified by resultFields of an existing object.
+     The other fields of the object are left untouched, so that one object can be reused for all the rows.
+     */
+    template<class ObjectType>
+    void extractOneObject(ObjectType& obj, const ResultFields& resultFields)
+    {
+        WCDB_CPP_ORM_STATIC_ASSERT_FOR_OBJECT_TYPE
         int index = 0;
+        HandleStatement* handleStatement = getInnerHandleStatement();
         for (const ResultField& field : resultFields) {
             const BaseAccessor* accessor = field.getAccessor();
+            BaseAccessor::StaticExtractor extractor = accessor->getStaticExtractor();
+            if (extractor != nullptr && handleStatement != nullptr) {
+                extractor(accessor, &obj, RowView(handleStatement), index);
+                index++;
+                continue;
+            }
             bool notNull = getType(index) != ColumnType::Null;
             switch (accessor->getColumnType()) {
             case ColumnType::Integer: {
@@ -313,7 +346,6 @@ public:
             }
             index++;
         }
-        return obj;
     }
 
     /**
@@ -336,6 +368,30 @@ public:
      */
     OptionalMultiRows getAllRows();
 
+    /**
+     @brief Step through all the rows in the result and pass each of them to enumerator as a `WCDB::RowView`.
+     It avoids materializing the result into `Value`s, which is much cheaper than `StatementOperation::getAllRows()` for large scans.
+     @param enumerator Return false to stop stepping. The row view is only valid inside the enumerator.
+     @return True if no error occurs.
+     */
+    bool enumerateRows(const RowViewEnumerator& enumerator);
+
+    /**
+     @brief Step through at most maxNumberOfRows rows and extract their columns into the buffers specified by batch.
+     It is suitable for analytics-style reads since the values of a column are stored contiguously.
+     @code
+     std::vector<int64_t> sizes;
+     WCDB::ColumnarBatch batch;
+     batch.integers(0, sizes);
+     while (statement.fetchBatch(batch, 1024) && batch.getNumberOfRows() > 0) {
+         // process sizes
+     }
+     @endcode
+     @return True if no error occurs. The number of rows extracted is returned by `ColumnarBatch::getNumberOfRows()`, which is 0 when the end of result is reached.
+     @see   `WCDB::ColumnarBatch`
+     */
+    bool fetchBatch(ColumnarBatch& batch, size_t maxNumberOfRows);
+
     /**
      @brief Extract the values of all rows in the result and assign them into the fields specified by resultFields of new objects.
      @return An array of objects.
@@ -358,12 +414,74 @@ public:
         return !result.hasValue() ? ValueArray<ObjectType>() : result;
     }
 
+    /**
+     @brief Step through all the rows in the result and pass each of them to enumerator as an object.
+     Unlike `StatementOperation::extractAllObjects()`, the result is not materialized. The same object is reused for all the rows, so the memory is constant regardless of the size of result.
+     @param enumerator Return false to stop stepping. Copy the object if it is needed outside the enumerator.
+     @return True if no error occurs.
+     */
+    template<class ObjectType>
+    bool enumerateObjects(const ResultFields& resultFields,
+                          const std::function<bool(ObjectType&)>& enumerator)
+    {
+        ObjectType obj;
+        bool succeed = false;
+        while ((succeed = step()) && !done()) {
+            extractOneObject(obj, resultFields);
+            if (!enumerator(obj)) {
+                break;
+            }
+        }
+        return succeed;
+    }
+
+    /**
+     @brief Step through at most maxNumberOfObjects rows and extract them into objects.
+     The objects already in the array are reused, and the array is truncated to the number of rows extracted.
+     @return True if no error occurs. The array is empty when the end of result is reached.
+     */
+    template<class ObjectType>
+    bool extractObjects(const ResultFields& resultFields,
+                        ValueArray<ObjectType>& objects,
+                        size_t maxNumberOfObjects)
+    {
+        size_t numberOfObjects = 0;
+        bool succeed = true;
+        // Step again after done will restart the statement.
+        while (numberOfObjects < maxNumberOfObjects && !done() && (succeed = step())
+               && !done()) {
+            if (numberOfObjects == objects.size()) {
+                objects.emplace_back();
+            }
+            extractOneObject(objects[numberOfObjects], resultFields);
+            ++numberOfObjects;
+        }
+        objects.erase(objects.begin() + numberOfObjects, objects.end());
+        return succeed;
+    }
+
     /**
      @brief Extract the results of a multi-table query.
      @return An array of `WCDB::MultiObject`.
      */
     OptionalMultiObjectArray extractAllMultiObjects(const ResultFields& resultFields);
 
+    /**
+     @brief Step through all the rows of a multi-table query and pass each of them to enumerator.
+     @param enumerator Return false to stop stepping.
+     @return True if no error occurs.
+     */
+    bool enumerateMultiObjects(const ResultFields& resultFields,
+                               const MultiObjectEnumerator& enumerator);
+
+    /**
+     @brief Step through at most maxNumberOfObjects rows of a multi-table query and extract them into objects, which is cleared first.
+     @return True if no error occurs. The array is empty when the end of result is reached.
+     */
+    bool extractMultiObjects(const ResultFields& resultFields,
+                             ValueArray<MultiObject>& objects,
+                             size_t maxNumberOfObjects);
+
 protected:
     virtual ~StatementOperation() = 0;
     virtual HandleStatement* getInnerHandleStatement() = 0;
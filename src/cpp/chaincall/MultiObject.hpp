@@ -92,5 +92,6 @@ private:
 
 typedef Optional<MultiObject> OptionalMultiObject;
 typedef OptionalValueArray<MultiObject> OptionalMultiObjectArray;
+typedef std::function<bool(MultiObject&)> MultiObjectEnumerator;
 
 } // namespace WCDB
@@ -117,4 +117,41 @@ OptionalMultiObjectArray MultiSelect::allMultiObjects()
     return objects;
 }
 
+bool MultiSelect::enumerateMultiObjects(const MultiObjectEnumerator &enumerator)
+{
+    WCTRemedialAssert(m_fields.size() != 0, "Result columns can't be empty.", return false;);
+    bool succeed = false;
+    if ((succeed = prepareStatement())) {
+        succeed = m_handle->enumerateMultiObjects(m_fields, enumerator);
+        m_handle->finalize();
+    }
+    saveChangesAndError(succeed);
+    m_handle->invalidate();
+    return succeed;
+}
+
+bool MultiSelect::nextBatch(ValueArray<MultiObject> &objects, size_t maxNumberOfObjects)
+{
+    WCTRemedialAssert(m_fields.size() != 0, "Result columns can't be empty.", return false;);
+    // An empty batch means the end, after which the query restarts from the first row.
+    WCTRemedialAssert(maxNumberOfObjects > 0,
+                      "The max number of objects in a batch must be greater than 0.",
+                      objects.clear();
+                      return false;);
+    bool succeed = false;
+    if ((succeed = prepareStatement())) {
+        succeed = m_handle->extractMultiObjects(m_fields, objects, maxNumberOfObjects);
+        if (succeed && objects.size() > 0) {
+            return true;
+        }
+        m_handle->finalize();
+    }
+    if (!succeed) {
+        objects.clear();
+    }
+    saveChangesAndError(succeed);
+    m_handle->invalidate();
+    return succeed;
+}
+
 } //namespace WCDB
@@ -98,6 +98,23 @@ public:
      */
     OptionalMultiObjectArray allMultiObjects();
 
+    /**
+     @brief Step through the selected objects and pass each of them to enumerator, without collecting them into an array.
+     @param enumerator Return false to stop.
+     @return True if no error occurs.
+     */
+    bool enumerateMultiObjects(const MultiObjectEnumerator &enumerator);
+
+    /**
+     @brief Get at most maxNumberOfObjects of the selected objects following the previous batch.
+     The statement is kept prepared between calls until the end is reached.
+     @warning The handle and its read snapshot are kept until the end is reached or the `MultiSelect` is destroyed,
+     which blocks the checkpoint of database meanwhile. So don't keep a partially consumed `MultiSelect` for long.
+     @param maxNumberOfObjects Must be greater than 0.
+     @return True if no error occurs. The array is empty when the end is reached.
+     */
+    bool nextBatch(ValueArray<MultiObject> &objects, size_t maxNumberOfObjects);
+
 protected:
     MultiSelect(Recyclable<InnerDatabase *> databaseHolder);
 
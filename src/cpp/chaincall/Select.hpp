@@ -39,6 +39,8 @@ class Select final : public ChainCall<StatementSelect> {
 public:
     ~Select() override final = default;
 
+    typedef std::function<bool(ObjectType &)> ObjectEnumerator;
+
     /**
      WINQ interface for SQL.
      @param condition condition
@@ -122,6 +124,68 @@ public:
         return objects;
     }
 
+    /**
+     @brief Step through the selected objects and pass each of them to enumerator, without collecting them into an array.
+     The same object is reused for all the rows, so the memory is constant regardless of the number of selected objects.
+
+         select.enumerateObjects([](Sample &object) {
+             // process object
+             return true;
+         });
+
+     @param enumerator Return false to stop. Copy the object if it is needed outside the enumerator.
+     @return True if no error occurs.
+     */
+    bool enumerateObjects(const ObjectEnumerator &enumerator)
+    {
+        bool succeed = false;
+        if ((succeed = prepareStatement())) {
+            succeed = m_handle->enumerateObjects<ObjectType>(m_fields, enumerator);
+            m_handle->finalize();
+        }
+        saveChangesAndError(succeed);
+        m_handle->invalidate();
+        return succeed;
+    }
+
+    /**
+     @brief Get at most maxNumberOfObjects of the selected objects following the previous batch.
+     The statement is kept prepared between calls until the end is reached, and the objects already in the array are reused.
+
+         WCDB::ValueArray<Sample> objects;
+         while (select.nextBatch(objects, 1000) && objects.size() > 0) {
+             // process objects
+         }
+
+     @warning The handle and its read snapshot are kept until the end is reached or the `Select` is destroyed,
+     which blocks the checkpoint of database meanwhile. So don't keep a partially consumed `Select` for long.
+     @param maxNumberOfObjects Must be greater than 0.
+     @return True if no error occurs. The array is empty when the end is reached.
+     */
+    bool nextBatch(ValueArray<ObjectType> &objects, size_t maxNumberOfObjects)
+    {
+        if (maxNumberOfObjects == 0) {
+            // An empty batch means the end, after which the query restarts from the first row.
+            assertError("The max number of objects in a batch must be greater than 0.");
+            objects.clear();
+            return false;
+        }
+        bool succeed = false;
+        if ((succeed = prepareStatement())) {
+            succeed = m_handle->extractObjects<ObjectType>(m_fields, objects, maxNumberOfObjects);
+            if (succeed && objects.size() > 0) {
+                return true;
+            }
+            m_handle->finalize();
+        }
+        if (!succeed) {
+            objects.clear();
+        }
+        saveChangesAndError(succeed);
+        m_handle->invalidate();
+        return succeed;
+    }
+
     /**
      @brief Get first selected object.
      */
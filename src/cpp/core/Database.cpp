@@ -181,6 +181,26 @@ void Database::unblockade()
     m_innerDatabase->unblockade();
 }
 
+void Database::enableSingleWriterMode(bool enable)
+{
+    m_innerDatabase->enableSingleWriterMode(enable);
+}
+
+#pragma mark - Group Commit
+bool Database::runTransactionInGroup(TransactionCallback inTransaction)
+{
+    return m_innerDatabase->runTransactionInGroup(
+    [inTransaction, this](InnerHandle* innerHandle) {
+        Handle handle = Handle(getDatabaseHolder(), innerHandle);
+        return inTransaction(handle);
+    });
+}
+
+void Database::setGroupCommitWindow(double seconds, int maxNumberOfTransactions)
+{
+    m_innerDatabase->setGroupCommitWindow(seconds, maxNumberOfTransactions);
+}
+
 #pragma mark - CheckPoint
 
 bool Database::truncateCheckpoint()
@@ -198,6 +218,43 @@ void Database::enableAutoCheckpoint(bool enable)
     CommonCore::shared().enableAutoCheckpoint(m_innerDatabase, enable);
 }
 
+Database::CheckpointStatistics Database::getCheckpointStatistics() const
+{
+    auto statistics = CommonCore::shared().getCheckpointStatistics(m_innerDatabase->getPath());
+    CheckpointStatistics result;
+    result.passiveCount = statistics.passiveCount;
+    result.fullCount = statistics.fullCount;
+    result.restartCount = statistics.restartCount;
+    result.truncateCount = statistics.truncateCount;
+    result.blockedCount = statistics.blockedCount;
+    result.urgentCount = statistics.urgentCount;
+    result.walFrames = statistics.walFrames;
+    result.maxWALFrames = statistics.maxWALFrames;
+    result.frameRate = statistics.frameRate;
+    result.lastDelay = statistics.lastDelay;
+    return result;
+}
+
+#pragma mark - Auto Operation
+
+void Database::setNumberOfOperationWorkers(int numberOfWorkers)
+{
+    CommonCore::shared().setNumberOfOperationWorkers(numberOfWorkers);
+}
+
+Database::OperationQueueStatistics Database::getOperationQueueStatistics()
+{
+    auto statistics = CommonCore::shared().getOperationQueueStatistics();
+    OperationQueueStatistics result;
+    result.numberOfPendingOperations = statistics.numberOfPendingOperations;
+    result.numberOfWaitingOperations = statistics.numberOfWaitingOperations;
+    result.numberOfRunningOperations = statistics.numberOfRunningOperations;
+    result.numberOfExecutedOperations = statistics.numberOfExecutedOperations;
+    result.totalLatency = statistics.totalLatency;
+    result.maxLatency = statistics.maxLatency;
+    return result;
+}
+
 #pragma mark - Vacuum
 
 bool Database::vacuum(ProgressUpdateCallback onProgressUpdated)
@@ -435,6 +492,11 @@ void Database::purgeAll()
     CommonCore::shared().purgeDatabasePool();
 }
 
+void Database::setPreparedStatementCacheBudget(int maxCount, size_t maxMemory)
+{
+    m_innerDatabase->setPreparedStatementCacheBudget(maxCount, maxMemory);
+}
+
 #pragma mark - Repair
 
 void Database::setNotificationWhenCorrupted(Database::CorruptionNotification onCorrupted)
@@ -595,6 +657,11 @@ void Database::enableAutoMigration(bool flag)
     CommonCore::shared().enableAutoMigrate(m_innerDatabase, flag);
 }
 
+void Database::enableRangeMigration(bool enable)
+{
+    m_innerDatabase->enableRangeMigration(enable);
+}
+
 void Database::setNotificationWhenMigrated(Database::MigratedCallback onMigrated)
 {
     InnerDatabase::MigratedCallback callback = nullptr;
@@ -700,6 +767,33 @@ bool Database::registerZSTDDict(const UnsafeData& dict, DictId dictId)
     return CompressionCenter::shared().registerDict(dictId, dict);
 }
 
+void Database::setDecompressionCacheBudget(size_t maxMemory)
+{
+    CompressionCenter::shared().setDecompressionCacheBudget(maxMemory);
+}
+
+Database::DecompressionCacheStatistics Database::getDecompressionCacheStatistics()
+{
+    auto statistics = CompressionCenter::shared().getDecompressionCacheStatistics();
+    DecompressionCacheStatistics result;
+    result.hitCount = statistics.hitCount;
+    result.missCount = statistics.missCount;
+    result.evictionCount = statistics.evictionCount;
+    result.usedMemory = statistics.usedMemory;
+    return result;
+}
+
+Optional<Data> Database::trainDict(const UnsafeStringView& table,
+                                   const Column& column,
+                                   DictId dictId,
+                                   int maxNumberOfSamples,
+                                   size_t maxSampleSize,
+                                   size_t maxTotalSampleSize)
+{
+    return m_innerDatabase->trainDict(
+    table, column.syntax().name, dictId, maxNumberOfSamples, maxSampleSize, maxTotalSampleSize);
+}
+
 void Database::setCompression(const CompressionFilter& filter)
 {
     InnerDatabase::CompressionTableFilter callback = nullptr;
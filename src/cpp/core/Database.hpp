@@ -158,6 +158,39 @@ public:
      */
     void unblockade();
 
+    /**
+     @brief Enable single writer mode.
+     In single writer mode, all write operations of this database are executed through one dedicated sqlite db handle, and the threads that want to write will wait in FIFO order.
+     Read operations still run concurrently in other handles.
+     It avoids the busy retries among multiple write handles and makes the write latency predictable when writes are highly concurrent.
+     @warning A thread reuses the handle it's already holding for all operations of this database, so that it never waits for itself.
+     So if a thread is holding a handle for reading, e.g. a `Handle` whose first operation is a read, or a read operation that is still stepping, the writes of this thread are executed through that handle instead of the writer handle.
+     These writes are not queued with the others, and they may be retried when they are busy.
+     */
+    void enableSingleWriterMode(bool enable);
+
+#pragma mark - Group Commit
+    /**
+     @brief Run a transaction that is committed together with the transactions submitted by other threads at the same time.
+     The submitted transactions are coalesced into one database transaction by one of the submitting threads, so that the cost of committing, especially the sync of WAL, is shared by all of them.
+     Each transaction is run in a savepoint, so that it succeeds or fails independently. The result will be returned after the whole group is committed.
+     
+         database.runTransactionInGroup([&](WCDB::Handle &handle) {
+             return handle.insertRows(rows, columns, tableName);
+         });
+     
+     @warning The transaction may be executed in another thread, so it should not depend on the thread local states.
+     @return True only if this transaction is committed.
+     */
+    bool runTransactionInGroup(TransactionCallback inTransaction);
+
+    /**
+     @brief Config the batching of `Database::runTransactionInGroup()`.
+     @param seconds The time the committing thread waits for more transactions. 0 means only the transactions submitted during the previous commit are grouped, which is the default.
+     @param maxNumberOfTransactions The max number of transactions committed in one group. The default value is 128.
+     */
+    void setGroupCommitWindow(double seconds, int maxNumberOfTransactions);
+
 #pragma mark - CheckPoint
 
     /**
@@ -176,6 +209,52 @@ public:
      */
     void enableAutoCheckpoint(bool enable);
 
+    struct CheckpointStatistics {
+        uint64_t passiveCount;
+        uint64_t fullCount;
+        uint64_t restartCount;
+        uint64_t truncateCount;
+        uint64_t blockedCount;
+        uint64_t urgentCount;
+        int walFrames;
+        int maxWALFrames;
+        double frameRate;
+        double lastDelay;
+    };
+
+    /**
+     @brief Get the statistics of auto-checkpoint for current database.
+     Auto-checkpoint is scheduled earlier when the wal file is large or the write rate is high, and later when the database is idle.
+     It's escalated from passive mode to full, restart and truncate mode when the wal file grows too large or the checkpoints keep being blocked by readers.
+     @note `blockedCount` is the number of checkpoints that failed to write all the frames back because of readers. `urgentCount` is the number of checkpoints scheduled with a shortened delay. `walFrames` is the number of frames in wal file reported by the last commit. `frameRate` is the smoothed number of frames written per second. `lastDelay` is the delay in seconds of the last scheduled checkpoint.
+     */
+    CheckpointStatistics getCheckpointStatistics() const;
+
+#pragma mark - Auto Operation
+
+    /**
+     @brief Set the number of threads that run the auto operations of all databases, including checkpoint, backup, migration, compression, FTS index merging and integrity check.
+     The operations of the same database are never run concurrently, and checkpoint is run ahead of backup, migration and compression. The default value is 2.
+     @param numberOfWorkers The number of threads, which should be in [1, 8].
+     */
+    static void setNumberOfOperationWorkers(int numberOfWorkers);
+
+    struct OperationQueueStatistics {
+        size_t numberOfPendingOperations;
+        size_t numberOfWaitingOperations;
+        size_t numberOfRunningOperations;
+        uint64_t numberOfExecutedOperations;
+        double totalLatency;
+        double maxLatency;
+    };
+
+    /**
+     @brief Get the statistics of the queue running the auto operations of all databases.
+     @note `numberOfPendingOperations` is the number of operations that are scheduled but not due yet. `numberOfWaitingOperations` is the number of due operations waiting for a free thread or for the running operation of the same database. `totalLatency` and `maxLatency` are the seconds from due to run of the executed operations.
+     @see `static Database::setNumberOfOperationWorkers()`
+     */
+    static OperationQueueStatistics getOperationQueueStatistics();
+
 #pragma mark - Vacuum
 
     /**
@@ -555,6 +634,16 @@ public:
      */
     static void purgeAll();
 
+    /**
+     @brief Limit the prepared statements cached in each sqlite db handle of this database.
+     The statements prepared by `Handle::getOrCreatePreparedStatement()` are cached in handle until they are finalized.
+     Once the budget is exceeded, the least recently used ones that are neither held by caller nor being stepped will be finalized and released.
+     A statement held by caller keeps its bindings, while the one got again after being released is prepared again without bindings.
+     @param maxCount Max count of cached statements in each handle. 0 means unlimited.
+     @param maxMemory Max memory in bytes used by cached statements in each handle. 0 means unlimited.
+     */
+    void setPreparedStatementCacheBudget(int maxCount, size_t maxMemory = 0);
+
 #pragma mark - Repair
     /**
      Triggered when a database is confirmed to be corrupted.
@@ -787,6 +876,13 @@ public:
      */
     void enableAutoMigration(bool flag);
 
+    /**
+     @brief Configure the database to migrate a range of rows with one `INSERT ... SELECT` and one `DELETE` in each batch, instead of one row at a time.
+     The size of the range is adapted to the time spent by each step of migration.
+     @param enable to enable range migration.
+     */
+    void enableRangeMigration(bool enable);
+
     /**
      Triggered when a table or a database is migrated completely. 
      When a table is migrated successfully, tableInfo will carry the information of the table.
@@ -883,6 +979,50 @@ public:
      */
     static bool registerZSTDDict(const UnsafeData &dict, DictId dictId);
 
+    /**
+     @brief Configure the memory budget of the cache of decompressed contents, which is shared by all databases.
+     The decompressed result of a compressed content is cached, so that reading the same compressed content repeatedly, such as the hot rows, does not need to decompress it again.
+     The least recently used results will be evicted when the budget is exceeded.
+     The cache is split into 16 parts by content to avoid contention among threads, each of which takes an equal part of the budget. So a content, with its decompressed result, larger than 1/16 of the budget will not be cached.
+     @param maxMemory Max memory in bytes used by the cache. 0 means the cache is disabled, which is the default.
+     */
+    static void setDecompressionCacheBudget(size_t maxMemory);
+
+    struct DecompressionCacheStatistics {
+        uint64_t hitCount;
+        uint64_t missCount;
+        uint64_t evictionCount;
+        size_t usedMemory;
+    };
+
+    /**
+     @brief Get the statistics of the cache of decompressed contents.
+     @see `Database::setDecompressionCacheBudget()`
+     */
+    static DecompressionCacheStatistics getDecompressionCacheStatistics();
+
+    /**
+     @brief Train a zstd formalized dict with the content sampled from a compressing column of current database, and register it into WCDB.
+     The content is sampled in one pass with reservoir sampling, within the limits of `maxNumberOfSamples` and `maxTotalSampleSize`. The contents larger than `maxSampleSize` are skipped.
+     After the dict is registered, the existing content of the column will be recompressed with it, which is done by the auto compression or `Database::stepCompression()`.
+     The compression ratio and decompression time of the samples before and after using the new dict are reported as a notice through `Database::globalTraceError()`.
+     @warning The column is only compressed with the new dict in the current process. You should save the returned dict and register it on the next launch, otherwise the recompressed content can not be decompressed.
+     @warning The database will be closed to apply the new dict, so this method fails when it is called within a transaction or while current thread is holding a handle of the database.
+     @param table name of the table.
+     @param column a column configured to be compressed in `Database::setCompression()`.
+     @param dictId spercified id of the result dict. It can not be zero or a registered id.
+     @param maxNumberOfSamples max number of sampled contents.
+     @param maxSampleSize max size of a sampled content in bytes.
+     @param maxTotalSampleSize max total size of sampled contents in bytes.
+     @return a dict of 100KB if succeed.
+     */
+    Optional<Data> trainDict(const UnsafeStringView &table,
+                             const Column &column,
+                             DictId dictId,
+                             int maxNumberOfSamples = 10000,
+                             size_t maxSampleSize = 128 * 1024,
+                             size_t maxTotalSampleSize = 10 * 1024 * 1024);
+
     /**
      Triggered at any time when WCDB needs to know whether a table in the current database needs to compress data,
      mainly including creating a new table, reading and writing a table,and starting to compress a new table.
@@ -85,9 +85,10 @@ HandleStatement* Handle::getInnerHandleStatement()
     return handle->m_mainStatement;
 }
 
-RecyclableHandle Handle::getHandleHolder(bool)
+RecyclableHandle Handle::getHandleHolder(bool writeHint)
 {
-    getOrGenerateHandle(false);
+    // The first operation decides whether it's a writer handle, which matters in single writer mode.
+    getOrGenerateHandle(writeHint);
     if (m_handleHolder != nullptr) {
         return m_handleHolder;
     } else {
@@ -142,11 +143,13 @@ OptionalPreparedStatement Handle::getOrCreatePreparedStatement(const Statement&
 {
     OptionalPreparedStatement result;
     GetInnerHandleOrReturnValue(result);
-    HandleStatement* preparedStatement = handle->getOrCreatePreparedStatement(statement);
+    AbstractHandle::PreparedStatementReference reference;
+    HandleStatement* preparedStatement
+    = handle->getOrCreatePreparedStatement(statement, reference);
     if (preparedStatement == nullptr) {
         return result;
     }
-    return PreparedStatement(preparedStatement);
+    return PreparedStatement(preparedStatement, reference);
 }
 
 void Handle::finalizeAllStatement()
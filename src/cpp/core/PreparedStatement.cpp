@@ -27,13 +27,14 @@
 
 namespace WCDB {
 
-PreparedStatement::PreparedStatement(HandleStatement* handleStatement)
-: m_innerHandleStatement(handleStatement)
+PreparedStatement::PreparedStatement(HandleStatement* handleStatement,
+                                     const std::shared_ptr<void>& reference)
+: m_innerHandleStatement(handleStatement), m_reference(reference)
 {
 }
 
 PreparedStatement::PreparedStatement(PreparedStatement&& other)
-: m_innerHandleStatement(other.m_innerHandleStatement)
+: m_innerHandleStatement(other.m_innerHandleStatement), m_reference(other.m_reference)
 {
 }
 
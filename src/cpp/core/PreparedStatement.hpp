@@ -26,6 +26,7 @@
 #include "CPPDeclaration.h"
 #include "Statement.hpp"
 #include "StatementOperation.hpp"
+#include <memory>
 
 namespace WCDB {
 
@@ -40,7 +41,7 @@ protected:
     PreparedStatement() = delete;
     PreparedStatement(const PreparedStatement &) = delete;
     PreparedStatement &operator=(const PreparedStatement &) = delete;
-    PreparedStatement(HandleStatement *handleStatement);
+    PreparedStatement(HandleStatement *handleStatement, const std::shared_ptr<void> &reference);
 
     HandleStatement *getInnerHandleStatement() override final;
     using StatementOperation::prepare;
@@ -49,6 +50,8 @@ protected:
 
 private:
     HandleStatement *m_innerHandleStatement;
+    // The cached statement is kept prepared while it's referenced.
+    std::shared_ptr<void> m_reference;
 };
 
 typedef Optional<PreparedStatement> OptionalPreparedStatement;
@@ -27,8 +27,27 @@
 
 namespace WCDB {
 
-BaseAccessor::BaseAccessor() = default;
+BaseAccessor::BaseAccessor()
+: m_staticBinder(nullptr), m_staticExtractor(nullptr)
+{
+}
 
 BaseAccessor::~BaseAccessor() = default;
 
+BaseAccessor::StaticBinder BaseAccessor::getStaticBinder() const
+{
+    return m_staticBinder;
+}
+
+BaseAccessor::StaticExtractor BaseAccessor::getStaticExtractor() const
+{
+    return m_staticExtractor;
+}
+
+void BaseAccessor::setStaticRoutines(StaticBinder binder, StaticExtractor extractor)
+{
+    m_staticBinder = binder;
+    m_staticExtractor = extractor;
+}
+
 } // namespace WCDB
@@ -29,11 +29,34 @@
 
 namespace WCDB {
 
+class StatementOperation;
+class RowView;
+
 class WCDB_API BaseAccessor {
 public:
     BaseAccessor();
     virtual ~BaseAccessor() = 0;
     virtual ColumnType getColumnType() const = 0;
+
+    /**
+     Statically typed routines generated by the ORM macros, which bind/extract the field without virtual dispatch.
+     They are null for the accessors not created by `WCDB_CPP_SYNTHESIZE`.
+     */
+    typedef void (*StaticBinder)(const BaseAccessor* accessor,
+                                 const void* object,
+                                 StatementOperation& operation,
+                                 int index);
+    typedef void (*StaticExtractor)(const BaseAccessor* accessor,
+                                    void* object,
+                                    const RowView& rowView,
+                                    int index);
+    StaticBinder getStaticBinder() const;
+    StaticExtractor getStaticExtractor() const;
+    void setStaticRoutines(StaticBinder binder, StaticExtractor extractor);
+
+private:
+    StaticBinder m_staticBinder;
+    StaticExtractor m_staticExtractor;
 };
 
 template<class O, WCDB::ColumnType t>
@@ -43,6 +66,8 @@ protected:
     using ORMType = O;
 
 public:
+    static constexpr const ColumnType columnType = t;
+
     virtual ~Accessor() override = default;
     ColumnType getColumnType() const override final { return t; };
 
@@ -0,0 +1,102 @@
+//
+// Created by qiuwenchen on 2026/10/16.
+//
+
+/*
+ * Tencent is pleased to support the open source community by making
+ * WCDB available.
+ *
+ * Copyright (C) 2017 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the BSD 3-Clause License (the "License"); you may not use
+ * this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *       https://opensource.org/licenses/BSD-3-Clause
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "RunTimeAccessor.hpp"
+#include "STDOptionalAccessor.hpp"
+#include "SharedPtrAccessor.hpp"
+#include "StatementOperation.hpp"
+#include "WCDBOptionalAccessor.hpp"
+
+namespace WCDB {
+
+/**
+ Statically typed bind/extract routines of a field.
+ Since the concrete accessor type is known here, the calls to its final methods are devirtualized and inlined,
+ and the column type is resolved at compile time instead of switching on `BaseAccessor::getColumnType()`.
+ */
+template<class ORMType, typename FieldType>
+class StaticFieldRoutines final {
+    using AccessorType = RuntimeAccessor<ORMType, FieldType>;
+    using UnderlyingType = typename ColumnTypeInfo<AccessorType::columnType>::UnderlyingType;
+
+public:
+    static void
+    bind(const BaseAccessor* accessor, const void* object, StatementOperation& operation, int index)
+    {
+        auto runtimeAccessor = static_cast<const AccessorType*>(accessor);
+        const ORMType& instance = *static_cast<const ORMType*>(object);
+        if (!runtimeAccessor->isNull(instance)) {
+            bindValue(operation, runtimeAccessor->getValue(instance), index);
+        } else {
+            operation.bindNull(index);
+        }
+    }
+
+    static void
+    extract(const BaseAccessor* accessor, void* object, const RowView& rowView, int index)
+    {
+        auto runtimeAccessor = static_cast<const AccessorType*>(accessor);
+        ORMType& instance = *static_cast<ORMType*>(object);
+        if (!rowView.isNull(index)) {
+            runtimeAccessor->setValue(instance, rowView.get<UnderlyingType>(index));
+        } else {
+            runtimeAccessor->setNull(instance);
+        }
+    }
+
+private:
+    static void bindValue(StatementOperation& operation, const int64_t& value, int index)
+    {
+        operation.bindInteger(value, index);
+    }
+
+    static void bindValue(StatementOperation& operation, const double& value, int index)
+    {
+        operation.bindDouble(value, index);
+    }
+
+    static void
+    bindValue(StatementOperation& operation, const UnsafeStringView& value, int index)
+    {
+        operation.bindText(value, index);
+    }
+
+    static void bindValue(StatementOperation& operation, const UnsafeData& value, int index)
+    {
+        operation.bindBLOB(value, index);
+    }
+};
+
+template<class ORMType, typename FieldType>
+BaseAccessor* makeRuntimeAccessor(FieldType ORMType::*memberPointer)
+{
+    BaseAccessor* accessor = new RuntimeAccessor<ORMType, FieldType>(memberPointer);
+    accessor->setStaticRoutines(&StaticFieldRoutines<ORMType, FieldType>::bind,
+                                &StaticFieldRoutines<ORMType, FieldType>::extract);
+    return accessor;
+}
+
+} //namespace WCDB
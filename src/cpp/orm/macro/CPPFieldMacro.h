@@ -25,6 +25,7 @@
 #pragma once
 
 #include "Macro.h"
+#include "StaticFieldRoutines.hpp"
 
 #define __WCDB_CPP_SYNTHESIZE_IMP(fieldName, columnName)                                          \
     auto _mp_##fieldName = &WCDBORMType::fieldName;                                               \
@@ -34,6 +35,6 @@
     auto& _field_##fieldName = g_binding->registerField(                                          \
     WCDB::castMemberPointer(_mp_##fieldName),                                                     \
     WCDB::StringView::makeConstant(_columnName_##fieldName),                                      \
-    new WCDB::RuntimeAccessor<WCDBORMType, WCDB::getMemberType<decltype(_mp_##fieldName)>::type>( \
+    WCDB::makeRuntimeAccessor<WCDBORMType, WCDB::getMemberType<decltype(_mp_##fieldName)>::type>( \
     _mp_##fieldName));                                                                            \
     WCDB_UNUSED(_field_##fieldName);
@@ -0,0 +1,125 @@
+//
+// Created by qiuwenchen on 2026/10/16.
+//
+
+/*
+ * Tencent is pleased to support the open source community by making
+ * WCDB available.
+ *
+ * Copyright (C) 2017 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the BSD 3-Clause License (the "License"); you may not use
+ * this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *       https://opensource.org/licenses/BSD-3-Clause
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#import "CPPTestCase.h"
+
+class CPPStaticRoutinesBenchmarkObject {
+public:
+    int64_t identifier = 0;
+    double score = 0;
+    std::string content;
+
+    WCDB_CPP_ORM_DECLARATION(CPPStaticRoutinesBenchmarkObject)
+};
+
+WCDB_CPP_ORM_IMPLEMENTATION_BEGIN(CPPStaticRoutinesBenchmarkObject)
+WCDB_CPP_SYNTHESIZE(identifier)
+WCDB_CPP_SYNTHESIZE(score)
+WCDB_CPP_SYNTHESIZE(content)
+WCDB_CPP_ORM_IMPLEMENTATION_END
+
+class CPPAccessorBenchmarkObject {
+public:
+    int64_t identifier = 0;
+    double score = 0;
+    std::string content;
+
+    WCDB_CPP_ORM_DECLARATION(CPPAccessorBenchmarkObject)
+};
+
+// Register fields without static routines, so that they are bound and extracted via virtual accessor.
+#define CPP_SYNTHESIZE_WITH_ACCESSOR_ONLY(fieldName)                           \
+    g_binding->registerField(                                                  \
+    WCDB::castMemberPointer(&WCDBORMType::fieldName),                          \
+    WCDB::StringView::makeConstant(WCDB_STRINGIFY(fieldName)),                 \
+    new WCDB::RuntimeAccessor<WCDBORMType, decltype(WCDBORMType::fieldName)>(  \
+    &WCDBORMType::fieldName));
+
+WCDB_CPP_ORM_IMPLEMENTATION_BEGIN(CPPAccessorBenchmarkObject)
+CPP_SYNTHESIZE_WITH_ACCESSOR_ONLY(identifier)
+CPP_SYNTHESIZE_WITH_ACCESSOR_ONLY(score)
+CPP_SYNTHESIZE_WITH_ACCESSOR_ONLY(content)
+WCDB_CPP_ORM_IMPLEMENTATION_END
+
+template<class ObjectType>
+static WCDB::ValueArray<ObjectType> generateObjects(int count)
+{
+    WCDB::ValueArray<ObjectType> objects;
+    objects.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        ObjectType object;
+        object.identifier = i;
+        object.score = i * 0.5;
+        object.content = std::to_string(i);
+        objects.push_back(object);
+    }
+    return objects;
+}
+
+@interface CPPORMBindingBenchmark : CPPTableTestCase
+
+@end
+
+@implementation CPPORMBindingBenchmark
+
+- (void)doTestInsert:(BOOL (^)(void))insert andSelect:(BOOL (^)(void))select
+{
+    [self measureMetrics:self.class.defaultPerformanceMetrics
+    automaticallyStartMeasuring:false
+                       forBlock:^{
+                           TestCaseAssertTrue([self dropTable]);
+                           [self startMeasuring];
+                           TestCaseAssertTrue(insert());
+                           TestCaseAssertTrue(select());
+                           [self stopMeasuring];
+                       }];
+}
+
+- (void)test_static_routines
+{
+    auto objects = generateObjects<CPPStaticRoutinesBenchmarkObject>(1000000);
+    [self doTestInsert:^BOOL {
+        return self.database->createTable<CPPStaticRoutinesBenchmarkObject>(self.tableName.UTF8String)
+               && self.database->insertObjects<CPPStaticRoutinesBenchmarkObject>(objects, self.tableName.UTF8String);
+    }
+    andSelect:^BOOL {
+        auto result = self.database->getAllObjects<CPPStaticRoutinesBenchmarkObject>(self.tableName.UTF8String);
+        return result.succeed() && result.value().size() == objects.size();
+    }];
+}
+
+- (void)test_virtual_accessor
+{
+    auto objects = generateObjects<CPPAccessorBenchmarkObject>(1000000);
+    [self doTestInsert:^BOOL {
+        return self.database->createTable<CPPAccessorBenchmarkObject>(self.tableName.UTF8String)
+               && self.database->insertObjects<CPPAccessorBenchmarkObject>(objects, self.tableName.UTF8String);
+    }
+    andSelect:^BOOL {
+        auto result = self.database->getAllObjects<CPPAccessorBenchmarkObject>(self.tableName.UTF8String);
+        return result.succeed() && result.value().size() == objects.size();
+    }];
+}
+
+@end
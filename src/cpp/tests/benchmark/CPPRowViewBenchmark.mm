@@ -0,0 +1,106 @@
+//
+// Created by qiuwenchen on 2026/10/16.
+//
+
+/*
+ * Tencent is pleased to support the open source community by making
+ * WCDB available.
+ *
+ * Copyright (C) 2017 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the BSD 3-Clause License (the "License"); you may not use
+ * this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *       https://opensource.org/licenses/BSD-3-Clause
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#import "CPPTestCase.h"
+
+@interface CPPRowViewBenchmark : CPPTableTestCase
+
+@end
+
+@implementation CPPRowViewBenchmark
+
+- (void)setUp
+{
+    [super setUp];
+    TestCaseAssertTrue([self createValueTable]);
+    WCDB::StatementInsert insert = WCDB::StatementInsert()
+                                   .insertIntoTable(self.tableName.UTF8String)
+                                   .columns(self.columns)
+                                   .values(WCDB::BindParameter::bindParameters(2));
+    NSString* content = Random.shared.string;
+    TestCaseAssertTrue(self.database->runTransaction([&](WCDB::Handle& handle) {
+        if (!handle.prepare(insert)) {
+            return false;
+        }
+        for (int i = 0; i < 1000000; ++i) {
+            handle.reset();
+            handle.bindInteger(i, 1);
+            handle.bindText(content.UTF8String, 2);
+            if (!handle.step()) {
+                handle.finalize();
+                return false;
+            }
+        }
+        handle.finalize();
+        return true;
+    }));
+}
+
+- (void)doTestScan:(int64_t (^)(WCDB::Handle& handle))block
+{
+    WCDB::StatementSelect select = WCDB::StatementSelect().select(self.resultColumns).from(self.tableName.UTF8String);
+    __block int64_t sum = 0;
+    [self measureMetrics:self.class.defaultPerformanceMetrics
+    automaticallyStartMeasuring:false
+                       forBlock:^{
+                           WCDB::Handle handle = self.database->getHandle();
+                           TestCaseAssertTrue(handle.prepare(select));
+                           [self startMeasuring];
+                           sum = block(handle);
+                           [self stopMeasuring];
+                           handle.finalize();
+                           TestCaseAssertEqual(sum, (int64_t) 999999 * 1000000 / 2);
+                       }];
+}
+
+- (void)test_get_all_rows
+{
+    [self doTestScan:^int64_t(WCDB::Handle& handle) {
+        int64_t sum = 0;
+        WCDB::OptionalMultiRows rows = handle.getAllRows();
+        TestCaseAssertTrue(rows.succeed());
+        for (const WCDB::OneRowValue& row : rows.value()) {
+            sum += row[0].intValue();
+        }
+        return sum;
+    }];
+}
+
+- (void)test_enumerate_row_views
+{
+    [self doTestScan:^int64_t(WCDB::Handle& handle) {
+        int64_t sum = 0;
+        size_t length = 0;
+        TestCaseAssertTrue(handle.enumerateRows([&](const WCDB::RowView& rowView) {
+            auto row = rowView.getTuple<int64_t, WCDB::UnsafeStringView>();
+            sum += std::get<0>(row);
+            length += std::get<1>(row).length();
+            return true;
+        }));
+        TestCaseAssertTrue(length > 0);
+        return sum;
+    }];
+}
+
+@end
@@ -0,0 +1,108 @@
+//
+// Created by qiuwenchen on 2026/10/16.
+//
+
+/*
+ * Tencent is pleased to support the open source community by making
+ * WCDB available.
+ *
+ * Copyright (C) 2017 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the BSD 3-Clause License (the "License"); you may not use
+ * this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *       https://opensource.org/licenses/BSD-3-Clause
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BenchmarkFixture.hpp"
+#include "BenchmarkSuite.hpp"
+#include <random>
+
+namespace WCDB {
+
+namespace Benchmark {
+
+Object::Object() = default;
+
+Object::Object(int identifier_, const std::string &content_)
+: identifier(identifier_), content(content_)
+{
+}
+
+WCDB_CPP_ORM_IMPLEMENTATION_BEGIN(Object)
+WCDB_CPP_SYNTHESIZE(identifier)
+WCDB_CPP_SYNTHESIZE(content)
+WCDB_CPP_PRIMARY(identifier)
+WCDB_CPP_ORM_IMPLEMENTATION_END
+
+ValueArray<Object> generateObjects(size_t count, int startingFromIdentifier)
+{
+    static const char *s_words[] = {
+        "the", "quick", "brown", "fox", "jumps", "over", "lazy", "dog", "message",
+        "database", "wechat", "sqlite", "value", "content", "table", "index",
+    };
+    constexpr size_t numberOfWords = sizeof(s_words) / sizeof(s_words[0]);
+    // Stable seed makes the results comparable between releases.
+    std::mt19937 random(0);
+    ValueArray<Object> objects;
+    objects.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        std::string content;
+        size_t numberOfWordsInContent = 8 + random() % 24;
+        for (size_t j = 0; j < numberOfWordsInContent; ++j) {
+            if (j > 0) {
+                content.push_back(' ');
+            }
+            content.append(s_words[random() % numberOfWords]);
+        }
+        objects.emplace_back(startingFromIdentifier + (int) i, content);
+    }
+    return objects;
+}
+
+bool prepareTable(Database &database, const UnsafeStringView &table, size_t count)
+{
+    return database.createTable<Object>(table)
+           && database.insertObjects<Object>(generateObjects(count), table);
+}
+
+#pragma mark - Fixture
+const char *Fixture::tableName = "benchmarkTable";
+
+bool Fixture::setUp(const std::string &directory, const std::string &name)
+{
+    m_directory = directory;
+    m_database.reset(new Database(joinPath(directory, name)));
+    return m_database->removeFiles() && m_database->canOpen();
+}
+
+void Fixture::tearDown()
+{
+    if (m_database != nullptr) {
+        m_database->close();
+        m_database->removeFiles();
+        m_database.reset();
+    }
+}
+
+Database &Fixture::database()
+{
+    return *m_database;
+}
+
+const std::string &Fixture::directory() const
+{
+    return m_directory;
+}
+
+} // namespace Benchmark
+
+} // namespace WCDB
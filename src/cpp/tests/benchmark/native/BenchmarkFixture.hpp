@@ -0,0 +1,71 @@
+//
+// Created by qiuwenchen on 2026/10/16.
+//
+
+/*
+ * Tencent is pleased to support the open source community by making
+ * WCDB available.
+ *
+ * Copyright (C) 2017 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the BSD 3-Clause License (the "License"); you may not use
+ * this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *       https://opensource.org/licenses/BSD-3-Clause
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "WCDBCpp.h"
+#include <memory>
+#include <string>
+
+namespace WCDB {
+
+namespace Benchmark {
+
+class Object {
+public:
+    Object();
+    Object(int identifier, const std::string &content);
+
+    int identifier = 0;
+    std::string content;
+
+    WCDB_CPP_ORM_DECLARATION(Object)
+};
+
+// Generate objects with English-like content, so that the compression cases are meaningful.
+ValueArray<Object> generateObjects(size_t count, int startingFromIdentifier = 0);
+
+bool prepareTable(Database &database, const UnsafeStringView &table, size_t count);
+
+/**
+ Owns a fresh database file for one iteration of a case.
+ */
+class Fixture {
+public:
+    bool setUp(const std::string &directory, const std::string &name = "benchmark.db");
+    void tearDown();
+
+    Database &database();
+    const std::string &directory() const;
+
+    static const char *tableName;
+
+private:
+    std::string m_directory;
+    std::unique_ptr<Database> m_database;
+};
+
+} // namespace Benchmark
+
+} // namespace WCDB
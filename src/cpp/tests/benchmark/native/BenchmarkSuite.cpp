@@ -0,0 +1,186 @@
+//
+// Created by qiuwenchen on 2026/10/16.
+//
+
+/*
+ * Tencent is pleased to support the open source community by making
+ * WCDB available.
+ *
+ * Copyright (C) 2017 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the BSD 3-Clause License (the "License"); you may not use
+ * this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *       https://opensource.org/licenses/BSD-3-Clause
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BenchmarkSuite.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <sstream>
+
+namespace WCDB {
+
+namespace Benchmark {
+
+static size_t g_scale = 100000;
+
+size_t scale()
+{
+    return g_scale;
+}
+
+void setScale(size_t scale)
+{
+    g_scale = scale;
+}
+
+std::string joinPath(const std::string &directory, const std::string &name)
+{
+    if (directory.empty() || directory.back() == '/') {
+        return directory + name;
+    }
+    return directory + "/" + name;
+}
+
+Registrar::Registrar(std::function<Case()> factory)
+{
+    Suite::shared().registerCase(factory());
+}
+
+#pragma mark - Suite
+Suite &Suite::shared()
+{
+    static Suite *s_suite = new Suite();
+    return *s_suite;
+}
+
+Suite::Suite() = default;
+
+void Suite::registerCase(const Case &benchmarkCase)
+{
+    m_cases.push_back(benchmarkCase);
+}
+
+std::vector<Result> Suite::run(const Options &options) const
+{
+    std::vector<Result> results;
+    for (const Case &benchmarkCase : m_cases) {
+        if (!options.filter.empty()
+            && benchmarkCase.name.find(options.filter) == std::string::npos) {
+            continue;
+        }
+        fprintf(stderr, "Running %s...\n", benchmarkCase.name.c_str());
+        results.push_back(runCase(benchmarkCase, options));
+    }
+    return results;
+}
+
+Result Suite::runCase(const Case &benchmarkCase, const Options &options) const
+{
+    Result result;
+    result.name = benchmarkCase.name;
+    result.succeed = true;
+    std::vector<double> latencies;
+    for (size_t i = 0; i < options.iterations && result.succeed; ++i) {
+        std::string directory = joinPath(options.directory, benchmarkCase.name);
+        if (benchmarkCase.setUp != nullptr && !benchmarkCase.setUp(directory)) {
+            result.succeed = false;
+            break;
+        }
+        size_t numberOfItems = 0;
+        auto begin = std::chrono::steady_clock::now();
+        result.succeed = benchmarkCase.measure(numberOfItems);
+        auto end = std::chrono::steady_clock::now();
+        if (benchmarkCase.tearDown != nullptr) {
+            benchmarkCase.tearDown();
+        }
+        latencies.push_back(std::chrono::duration<double>(end - begin).count());
+        result.numberOfItems = numberOfItems;
+    }
+    if (!result.succeed || latencies.empty()) {
+        result.succeed = false;
+        return result;
+    }
+    std::sort(latencies.begin(), latencies.end());
+    double total = 0;
+    for (double latency : latencies) {
+        total += latency;
+    }
+    result.iterations = latencies.size();
+    result.minLatency = latencies.front();
+    result.maxLatency = latencies.back();
+    result.medianLatency = latencies[latencies.size() / 2];
+    result.p95Latency = latencies[std::min(latencies.size() - 1,
+                                           (size_t) (latencies.size() * 0.95))];
+    result.meanLatency = total / latencies.size();
+    if (result.medianLatency > 0) {
+        result.throughput = result.numberOfItems / result.medianLatency;
+    }
+    return result;
+}
+
+#pragma mark - JSON
+static std::string escapeJSONString(const std::string &string)
+{
+    std::ostringstream stream;
+    for (char c : string) {
+        switch (c) {
+        case '"':
+            stream << "\\\"";
+            break;
+        case '\\':
+            stream << "\\\\";
+            break;
+        case '\n':
+            stream << "\\n";
+            break;
+        default:
+            stream << c;
+            break;
+        }
+    }
+    return stream.str();
+}
+
+std::string Suite::toJSON(const std::vector<Result> &results)
+{
+    std::ostringstream stream;
+    stream << "{\n";
+    stream << "  \"version\": \"" << escapeJSONString(Database::getVersion().data())
+           << "\",\n";
+    stream << "  \"sourceId\": \"" << escapeJSONString(Database::getSourceId().data())
+           << "\",\n";
+    stream << "  \"benchmarks\": [";
+    bool first = true;
+    for (const Result &result : results) {
+        stream << (first ? "\n" : ",\n");
+        first = false;
+        stream << "    {\"name\": \"" << escapeJSONString(result.name) << "\", "
+               << "\"succeed\": " << (result.succeed ? "true" : "false") << ", "
+               << "\"iterations\": " << result.iterations << ", "
+               << "\"items\": " << result.numberOfItems << ", "
+               << "\"latencyInSeconds\": {"
+               << "\"min\": " << result.minLatency << ", "
+               << "\"median\": " << result.medianLatency << ", "
+               << "\"mean\": " << result.meanLatency << ", "
+               << "\"p95\": " << result.p95Latency << ", "
+               << "\"max\": " << result.maxLatency << "}, "
+               << "\"throughputPerSecond\": " << result.throughput << "}";
+    }
+    stream << "\n  ]\n}\n";
+    return stream.str();
+}
+
+} // namespace Benchmark
+
+} // namespace WCDB
@@ -0,0 +1,105 @@
+//
+// Created by qiuwenchen on 2026/10/16.
+//
+
+/*
+ * Tencent is pleased to support the open source community by making
+ * WCDB available.
+ *
+ * Copyright (C) 2017 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the BSD 3-Clause License (the "License"); you may not use
+ * this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *       https://opensource.org/licenses/BSD-3-Clause
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "WCDBCpp.h"
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace WCDB {
+
+namespace Benchmark {
+
+/**
+ A measured case. `setUp` and `tearDown` run around every iteration and are not timed.
+ `measure` returns false on failure and reports the number of items processed, which is used to compute throughput.
+ */
+struct Case {
+    std::string name;
+    std::function<bool(const std::string &directory)> setUp;
+    std::function<bool(size_t &numberOfItems)> measure;
+    std::function<void()> tearDown;
+};
+
+struct Result {
+    std::string name;
+    bool succeed = false;
+    size_t iterations = 0;
+    size_t numberOfItems = 0;
+    double minLatency = 0;
+    double medianLatency = 0;
+    double meanLatency = 0;
+    double p95Latency = 0;
+    double maxLatency = 0;
+    double throughput = 0;
+};
+
+struct Options {
+    std::string directory;
+    std::string output;
+    std::string filter;
+    size_t iterations = 5;
+    size_t scale = 100000;
+};
+
+class Suite final {
+public:
+    static Suite &shared();
+
+    void registerCase(const Case &benchmarkCase);
+    std::vector<Result> run(const Options &options) const;
+
+    static std::string toJSON(const std::vector<Result> &results);
+
+protected:
+    Suite();
+
+private:
+    Result runCase(const Case &benchmarkCase, const Options &options) const;
+
+    std::vector<Case> m_cases;
+};
+
+struct Registrar {
+    Registrar(std::function<Case()> factory);
+};
+
+// Number of rows each case operates on, configured by `--scale`.
+size_t scale();
+void setScale(size_t scale);
+
+std::string joinPath(const std::string &directory, const std::string &name);
+
+} // namespace Benchmark
+
+} // namespace WCDB
+
+#define WCDB_BENCHMARK_CONCAT_IMP(a, b) a##b
+#define WCDB_BENCHMARK_CONCAT(a, b) WCDB_BENCHMARK_CONCAT_IMP(a, b)
+
+#define WCDB_BENCHMARK_REGISTER(factory)                                       \
+    static WCDB::Benchmark::Registrar WCDB_BENCHMARK_CONCAT(                   \
+    g_benchmarkRegistrar, __LINE__)(factory)
@@ -0,0 +1,89 @@
+//
+// Created by qiuwenchen on 2026/10/16.
+//
+
+/*
+ * Tencent is pleased to support the open source community by making
+ * WCDB available.
+ *
+ * Copyright (C) 2017 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the BSD 3-Clause License (the "License"); you may not use
+ * this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *       https://opensource.org/licenses/BSD-3-Clause
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BenchmarkFixture.hpp"
+#include "BenchmarkSuite.hpp"
+
+namespace WCDB {
+
+namespace Benchmark {
+
+static const unsigned char s_cipherKey[] = "WCDBBenchmarkCipherKey";
+
+static void configCipher(Database &database)
+{
+    database.setCipherKey(UnsafeData::immutable(s_cipherKey, sizeof(s_cipherKey) - 1));
+}
+
+WCDB_BENCHMARK_REGISTER([]() {
+    auto fixture = std::make_shared<Fixture>();
+    auto objects = std::make_shared<ValueArray<Object>>();
+    Case benchmarkCase;
+    benchmarkCase.name = "cipher.insert";
+    benchmarkCase.setUp = [=](const std::string &directory) {
+        if (objects->size() != scale()) {
+            *objects = generateObjects(scale());
+        }
+        if (!fixture->setUp(directory)) {
+            return false;
+        }
+        configCipher(fixture->database());
+        return fixture->database().createTable<Object>(Fixture::tableName);
+    };
+    benchmarkCase.measure = [=](size_t &numberOfItems) {
+        numberOfItems = objects->size();
+        return fixture->database().insertObjects<Object>(*objects, Fixture::tableName);
+    };
+    benchmarkCase.tearDown = [=]() { fixture->tearDown(); };
+    return benchmarkCase;
+});
+
+WCDB_BENCHMARK_REGISTER([]() {
+    auto fixture = std::make_shared<Fixture>();
+    Case benchmarkCase;
+    benchmarkCase.name = "cipher.select";
+    benchmarkCase.setUp = [=](const std::string &directory) {
+        if (!fixture->setUp(directory)) {
+            return false;
+        }
+        configCipher(fixture->database());
+        if (!prepareTable(fixture->database(), Fixture::tableName, scale())) {
+            return false;
+        }
+        // Drop the page cache so that pages are decrypted again.
+        fixture->database().close();
+        return true;
+    };
+    benchmarkCase.measure = [=](size_t &numberOfItems) {
+        auto objects = fixture->database().getAllObjects<Object>(Fixture::tableName);
+        numberOfItems = objects.succeed() ? objects.value().size() : 0;
+        return objects.succeed() && numberOfItems == scale();
+    };
+    benchmarkCase.tearDown = [=]() { fixture->tearDown(); };
+    return benchmarkCase;
+});
+
+} // namespace Benchmark
+
+} // namespace WCDB
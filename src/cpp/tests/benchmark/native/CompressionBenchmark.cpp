@@ -0,0 +1,94 @@
+//
+// Created by qiuwenchen on 2026/10/16.
+//
+
+/*
+ * Tencent is pleased to support the open source community by making
+ * WCDB available.
+ *
+ * Copyright (C) 2017 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the BSD 3-Clause License (the "License"); you may not use
+ * this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *       https://opensource.org/licenses/BSD-3-Clause
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BenchmarkFixture.hpp"
+#include "BenchmarkSuite.hpp"
+
+namespace WCDB {
+
+namespace Benchmark {
+
+static void configCompression(Database &database)
+{
+    database.setCompression([](Database::CompressionInfo &info) {
+        if (info.getTableName().compare(Fixture::tableName) == 0) {
+            info.addZSTDNormalCompressField(WCDB_FIELD(Object::content));
+        }
+    });
+}
+
+static bool compressAll(Database &database)
+{
+    while (!database.isCompressed()) {
+        if (!database.stepCompression()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+WCDB_BENCHMARK_REGISTER([]() {
+    auto fixture = std::make_shared<Fixture>();
+    Case benchmarkCase;
+    benchmarkCase.name = "compression.compress";
+    benchmarkCase.setUp = [=](const std::string &directory) {
+        if (!fixture->setUp(directory)
+            || !prepareTable(fixture->database(), Fixture::tableName, scale())) {
+            return false;
+        }
+        configCompression(fixture->database());
+        return true;
+    };
+    benchmarkCase.measure = [=](size_t &numberOfItems) {
+        numberOfItems = scale();
+        return compressAll(fixture->database());
+    };
+    benchmarkCase.tearDown = [=]() { fixture->tearDown(); };
+    return benchmarkCase;
+});
+
+WCDB_BENCHMARK_REGISTER([]() {
+    auto fixture = std::make_shared<Fixture>();
+    Case benchmarkCase;
+    benchmarkCase.name = "compression.select_compressed";
+    benchmarkCase.setUp = [=](const std::string &directory) {
+        if (!fixture->setUp(directory)
+            || !prepareTable(fixture->database(), Fixture::tableName, scale())) {
+            return false;
+        }
+        configCompression(fixture->database());
+        return compressAll(fixture->database());
+    };
+    benchmarkCase.measure = [=](size_t &numberOfItems) {
+        auto objects = fixture->database().getAllObjects<Object>(Fixture::tableName);
+        numberOfItems = objects.succeed() ? objects.value().size() : 0;
+        return objects.succeed() && numberOfItems == scale();
+    };
+    benchmarkCase.tearDown = [=]() { fixture->tearDown(); };
+    return benchmarkCase;
+});
+
+} // namespace Benchmark
+
+} // namespace WCDB
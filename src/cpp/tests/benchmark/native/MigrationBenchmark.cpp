@@ -0,0 +1,75 @@
+//
+// Created by qiuwenchen on 2026/10/16.
+//
+
+/*
+ * Tencent is pleased to support the open source community by making
+ * WCDB available.
+ *
+ * Copyright (C) 2017 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the BSD 3-Clause License (the "License"); you may not use
+ * this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *       https://opensource.org/licenses/BSD-3-Clause
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BenchmarkFixture.hpp"
+#include "BenchmarkSuite.hpp"
+
+namespace WCDB {
+
+namespace Benchmark {
+
+static Case migrationCase(const char *name, bool byRange)
+{
+    auto source = std::make_shared<Fixture>();
+    auto target = std::make_shared<Fixture>();
+    Case benchmarkCase;
+    benchmarkCase.name = name;
+    benchmarkCase.setUp = [=](const std::string &directory) {
+        if (!source->setUp(directory, "source.db") || !target->setUp(directory, "target.db")
+            || !prepareTable(source->database(), Fixture::tableName, scale())) {
+            return false;
+        }
+        source->database().close();
+        target->database().addMigration(
+        source->database().getPath(), UnsafeData(), [](Database::MigrationInfo &info) {
+            if (info.table.compare(Fixture::tableName) == 0) {
+                info.sourceTable = Fixture::tableName;
+            }
+        });
+        target->database().enableRangeMigration(byRange);
+        return target->database().createTable<Object>(Fixture::tableName);
+    };
+    benchmarkCase.measure = [=](size_t &numberOfItems) {
+        numberOfItems = scale();
+        while (!target->database().isMigrated()) {
+            if (!target->database().stepMigration()) {
+                return false;
+            }
+        }
+        return true;
+    };
+    benchmarkCase.tearDown = [=]() {
+        target->tearDown();
+        source->tearDown();
+    };
+    return benchmarkCase;
+}
+
+WCDB_BENCHMARK_REGISTER([]() { return migrationCase("migration.migrate", false); });
+
+WCDB_BENCHMARK_REGISTER([]() { return migrationCase("migration.migrate_by_range", true); });
+
+} // namespace Benchmark
+
+} // namespace WCDB
@@ -0,0 +1,99 @@
+//
+// Created by qiuwenchen on 2026/10/16.
+//
+
+/*
+ * Tencent is pleased to support the open source community by making
+ * WCDB available.
+ *
+ * Copyright (C) 2017 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the BSD 3-Clause License (the "License"); you may not use
+ * this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *       https://opensource.org/licenses/BSD-3-Clause
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BenchmarkFixture.hpp"
+#include "BenchmarkSuite.hpp"
+
+namespace WCDB {
+
+namespace Benchmark {
+
+WCDB_BENCHMARK_REGISTER([]() {
+    auto fixture = std::make_shared<Fixture>();
+    auto objects = std::make_shared<ValueArray<Object>>();
+    Case benchmarkCase;
+    benchmarkCase.name = "orm.insert";
+    benchmarkCase.setUp = [=](const std::string &directory) {
+        if (objects->size() != scale()) {
+            *objects = generateObjects(scale());
+        }
+        return fixture->setUp(directory)
+               && fixture->database().createTable<Object>(Fixture::tableName);
+    };
+    benchmarkCase.measure = [=](size_t &numberOfItems) {
+        numberOfItems = objects->size();
+        return fixture->database().insertObjects<Object>(*objects, Fixture::tableName);
+    };
+    benchmarkCase.tearDown = [=]() { fixture->tearDown(); };
+    return benchmarkCase;
+});
+
+WCDB_BENCHMARK_REGISTER([]() {
+    auto fixture = std::make_shared<Fixture>();
+    Case benchmarkCase;
+    benchmarkCase.name = "orm.select";
+    benchmarkCase.setUp = [=](const std::string &directory) {
+        return fixture->setUp(directory)
+               && prepareTable(fixture->database(), Fixture::tableName, scale());
+    };
+    benchmarkCase.measure = [=](size_t &numberOfItems) {
+        auto objects = fixture->database().getAllObjects<Object>(Fixture::tableName);
+        numberOfItems = objects.succeed() ? objects.value().size() : 0;
+        return objects.succeed() && numberOfItems == scale();
+    };
+    benchmarkCase.tearDown = [=]() { fixture->tearDown(); };
+    return benchmarkCase;
+});
+
+WCDB_BENCHMARK_REGISTER([]() {
+    auto fixture = std::make_shared<Fixture>();
+    Case benchmarkCase;
+    benchmarkCase.name = "orm.scan_row_view";
+    benchmarkCase.setUp = [=](const std::string &directory) {
+        return fixture->setUp(directory)
+               && prepareTable(fixture->database(), Fixture::tableName, scale());
+    };
+    benchmarkCase.measure = [=](size_t &numberOfItems) {
+        Handle handle = fixture->database().getHandle();
+        if (!handle.prepare(StatementSelect()
+                            .select(Object::allFields())
+                            .from(Fixture::tableName))) {
+            return false;
+        }
+        size_t length = 0;
+        bool succeed = handle.enumerateRows([&](const RowView &rowView) {
+            length += rowView.getText(1).length();
+            ++numberOfItems;
+            return true;
+        });
+        handle.finalize();
+        return succeed && length > 0 && numberOfItems == scale();
+    };
+    benchmarkCase.tearDown = [=]() { fixture->tearDown(); };
+    return benchmarkCase;
+});
+
+} // namespace Benchmark
+
+} // namespace WCDB
@@ -0,0 +1,68 @@
+//
+// Created by qiuwenchen on 2026/10/16.
+//
+
+/*
+ * Tencent is pleased to support the open source community by making
+ * WCDB available.
+ *
+ * Copyright (C) 2017 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the BSD 3-Clause License (the "License"); you may not use
+ * this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *       https://opensource.org/licenses/BSD-3-Clause
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BenchmarkFixture.hpp"
+#include "BenchmarkSuite.hpp"
+
+namespace WCDB {
+
+namespace Benchmark {
+
+WCDB_BENCHMARK_REGISTER([]() {
+    auto fixture = std::make_shared<Fixture>();
+    Case benchmarkCase;
+    benchmarkCase.name = "repair.backup";
+    benchmarkCase.setUp = [=](const std::string &directory) {
+        return fixture->setUp(directory)
+               && prepareTable(fixture->database(), Fixture::tableName, scale());
+    };
+    benchmarkCase.measure = [=](size_t &numberOfItems) {
+        numberOfItems = scale();
+        return fixture->database().backup();
+    };
+    benchmarkCase.tearDown = [=]() { fixture->tearDown(); };
+    return benchmarkCase;
+});
+
+WCDB_BENCHMARK_REGISTER([]() {
+    auto fixture = std::make_shared<Fixture>();
+    Case benchmarkCase;
+    benchmarkCase.name = "repair.retrieve";
+    benchmarkCase.setUp = [=](const std::string &directory) {
+        return fixture->setUp(directory)
+               && prepareTable(fixture->database(), Fixture::tableName, scale())
+               && fixture->database().backup();
+    };
+    benchmarkCase.measure = [=](size_t &numberOfItems) {
+        numberOfItems = scale();
+        // A score not greater than 0 means that the retrieval failed.
+        return fixture->database().retrieve(nullptr) > 0;
+    };
+    benchmarkCase.tearDown = [=]() { fixture->tearDown(); };
+    return benchmarkCase;
+});
+
+} // namespace Benchmark
+
+} // namespace WCDB
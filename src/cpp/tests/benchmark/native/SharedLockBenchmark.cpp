@@ -0,0 +1,92 @@
+//
+// Created by qiuwenchen on 2026/10/16.
+//
+
+/*
+ * Tencent is pleased to support the open source community by making
+ * WCDB available.
+ *
+ * Copyright (C) 2017 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the BSD 3-Clause License (the "License"); you may not use
+ * this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *       https://opensource.org/licenses/BSD-3-Clause
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BenchmarkSuite.hpp"
+#include "Lock.hpp"
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace WCDB {
+
+namespace Benchmark {
+
+// Every thread takes the shared lock `scale()` times, and one in `writeInterval` of them is an exclusive one.
+// 0 for read only.
+static Case makeSharedLockCase(const std::string &name, int numberOfThreads, size_t writeInterval)
+{
+    auto lock = std::make_shared<SharedLock>();
+    Case benchmarkCase;
+    benchmarkCase.name = name;
+    benchmarkCase.setUp = [](const std::string &) { return true; };
+    benchmarkCase.measure = [=](size_t &numberOfItems) {
+        std::vector<std::thread> threads;
+        for (int i = 0; i < numberOfThreads; ++i) {
+            threads.emplace_back([=]() {
+                for (size_t j = 1; j <= scale(); ++j) {
+                    if (writeInterval > 0 && j % writeInterval == 0) {
+                        LockGuard lockGuard(*lock);
+                    } else {
+                        SharedLockGuard lockGuard(*lock);
+                    }
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        numberOfItems = scale() * numberOfThreads;
+        return true;
+    };
+    benchmarkCase.tearDown = []() {};
+    return benchmarkCase;
+}
+
+WCDB_BENCHMARK_REGISTER(
+[]() { return makeSharedLockCase("sharedlock.read.1threads", 1, 0); });
+
+WCDB_BENCHMARK_REGISTER(
+[]() { return makeSharedLockCase("sharedlock.read.4threads", 4, 0); });
+
+WCDB_BENCHMARK_REGISTER(
+[]() { return makeSharedLockCase("sharedlock.read.16threads", 16, 0); });
+
+WCDB_BENCHMARK_REGISTER(
+[]() { return makeSharedLockCase("sharedlock.read.64threads", 64, 0); });
+
+WCDB_BENCHMARK_REGISTER(
+[]() { return makeSharedLockCase("sharedlock.read_mostly.1threads", 1, 1000); });
+
+WCDB_BENCHMARK_REGISTER(
+[]() { return makeSharedLockCase("sharedlock.read_mostly.4threads", 4, 1000); });
+
+WCDB_BENCHMARK_REGISTER(
+[]() { return makeSharedLockCase("sharedlock.read_mostly.16threads", 16, 1000); });
+
+WCDB_BENCHMARK_REGISTER(
+[]() { return makeSharedLockCase("sharedlock.read_mostly.64threads", 64, 1000); });
+
+} // namespace Benchmark
+
+} // namespace WCDB
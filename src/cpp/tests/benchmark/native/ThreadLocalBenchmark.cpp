@@ -0,0 +1,112 @@
+//
+// Created by qiuwenchen on 2026/10/16.
+//
+
+/*
+ * Tencent is pleased to support the open source community by making
+ * WCDB available.
+ *
+ * Copyright (C) 2017 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the BSD 3-Clause License (the "License"); you may not use
+ * this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *       https://opensource.org/licenses/BSD-3-Clause
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BenchmarkSuite.hpp"
+#include "ThreadLocal.hpp"
+#include <atomic>
+#include <map>
+#include <memory>
+
+namespace WCDB {
+
+namespace Benchmark {
+
+// The map-based implementation that `ThreadLocal` replaced, kept as the baseline.
+template<typename T>
+class MapThreadLocal {
+public:
+    MapThreadLocal(const T &defaultValue)
+    : m_identifier(nextIdentifier()), m_default(defaultValue)
+    {
+    }
+
+    T &getOrCreate()
+    {
+        auto &storage = threadedStorage();
+        auto iter = storage.find(m_identifier);
+        if (iter == storage.end()) {
+            iter = storage.emplace(m_identifier, m_default).first;
+        }
+        return iter->second;
+    }
+
+private:
+    typedef unsigned int Identifier;
+    static Identifier nextIdentifier()
+    {
+        static std::atomic<Identifier> *s_identifier = new std::atomic<Identifier>(0);
+        return ++(*s_identifier);
+    }
+    static std::map<Identifier, T> &threadedStorage()
+    {
+        thread_local std::unique_ptr<std::map<Identifier, T>> s_storage(
+        new std::map<Identifier, T>());
+        return *s_storage;
+    }
+
+    const Identifier m_identifier;
+    const T m_default;
+};
+
+// Roughly the number of thread locals alive in a process with a few databases opened.
+static constexpr const int numberOfThreadLocals = 32;
+
+template<template<typename> class Local>
+static Case makeThreadLocalCase(const std::string &name)
+{
+    auto locals = std::make_shared<std::vector<std::unique_ptr<Local<int>>>>();
+    Case benchmarkCase;
+    benchmarkCase.name = name;
+    benchmarkCase.setUp = [=](const std::string &) {
+        for (int i = 0; i < numberOfThreadLocals; ++i) {
+            locals->emplace_back(new Local<int>(i));
+            locals->back()->getOrCreate();
+        }
+        return true;
+    };
+    benchmarkCase.measure = [=](size_t &numberOfItems) {
+        int64_t sum = 0;
+        for (size_t i = 0; i < scale(); ++i) {
+            for (auto &local : *locals) {
+                sum += ++local->getOrCreate();
+            }
+        }
+        numberOfItems = scale() * locals->size();
+        return sum != 0;
+    };
+    benchmarkCase.tearDown = [=]() { locals->clear(); };
+    return benchmarkCase;
+}
+
+WCDB_BENCHMARK_REGISTER([]() {
+    return makeThreadLocalCase<MapThreadLocal>("threadlocal.map");
+});
+
+WCDB_BENCHMARK_REGISTER([]() {
+    return makeThreadLocalCase<ThreadLocal>("threadlocal.slot");
+});
+
+} // namespace Benchmark
+
+} // namespace WCDB
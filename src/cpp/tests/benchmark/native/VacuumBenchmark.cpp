@@ -0,0 +1,55 @@
+//
+// Created by qiuwenchen on 2026/10/16.
+//
+
+/*
+ * Tencent is pleased to support the open source community by making
+ * WCDB available.
+ *
+ * Copyright (C) 2017 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the BSD 3-Clause License (the "License"); you may not use
+ * this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *       https://opensource.org/licenses/BSD-3-Clause
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BenchmarkFixture.hpp"
+#include "BenchmarkSuite.hpp"
+
+namespace WCDB {
+
+namespace Benchmark {
+
+WCDB_BENCHMARK_REGISTER([]() {
+    auto fixture = std::make_shared<Fixture>();
+    Case benchmarkCase;
+    benchmarkCase.name = "vacuum.vacuum";
+    benchmarkCase.setUp = [=](const std::string &directory) {
+        if (!fixture->setUp(directory)
+            || !prepareTable(fixture->database(), Fixture::tableName, scale())) {
+            return false;
+        }
+        // Leave half of the pages free so that vacuum has something to do.
+        return fixture->database().deleteObjects(
+        Fixture::tableName, WCDB_FIELD(Object::identifier) % 2 == 0);
+    };
+    benchmarkCase.measure = [=](size_t &numberOfItems) {
+        numberOfItems = scale() / 2;
+        return fixture->database().vacuum(nullptr);
+    };
+    benchmarkCase.tearDown = [=]() { fixture->tearDown(); };
+    return benchmarkCase;
+});
+
+} // namespace Benchmark
+
+} // namespace WCDB
@@ -0,0 +1,117 @@
+//
+// Created by qiuwenchen on 2026/10/16.
+//
+
+/*
+ * Tencent is pleased to support the open source community by making
+ * WCDB available.
+ *
+ * Copyright (C) 2017 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the BSD 3-Clause License (the "License"); you may not use
+ * this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *       https://opensource.org/licenses/BSD-3-Clause
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BenchmarkSuite.hpp"
+#include "WINQ.h"
+#include <memory>
+
+namespace WCDB {
+
+namespace Benchmark {
+
+static constexpr const int numberOfTermsInList = 500;
+static constexpr const int numberOfRowsToInsert = 100;
+
+static StatementSelect makeInList()
+{
+    Expressions terms;
+    for (int i = 0; i < numberOfTermsInList; ++i) {
+        terms.push_back(Expression(i));
+    }
+    return StatementSelect()
+    .select({ Column("id"), Column("name") })
+    .from("benchmark")
+    .where(Column("id").in(terms));
+}
+
+static StatementInsert makeMultiRowInsert()
+{
+    StatementInsert insert = StatementInsert()
+                             .insertIntoTable("benchmark")
+                             .columns({ Column("id"), Column("name"), Column("score") });
+    for (int i = 0; i < numberOfRowsToInsert; ++i) {
+        insert.values(BindParameter::bindParameters(3));
+    }
+    return insert;
+}
+
+template<typename Statement>
+static Case makeConstructionCase(const std::string &name, Statement (*make)())
+{
+    Case benchmarkCase;
+    benchmarkCase.name = name;
+    benchmarkCase.setUp = [](const std::string &) { return true; };
+    benchmarkCase.measure = [=](size_t &numberOfItems) {
+        bool valid = true;
+        for (size_t i = 0; i < scale(); ++i) {
+            valid = make().syntax().isValid() && valid;
+        }
+        numberOfItems = scale();
+        return valid;
+    };
+    benchmarkCase.tearDown = []() {};
+    return benchmarkCase;
+}
+
+template<typename Statement>
+static Case makeCopyCase(const std::string &name, Statement (*make)())
+{
+    auto statement = std::make_shared<Statement>();
+    Case benchmarkCase;
+    benchmarkCase.name = name;
+    benchmarkCase.setUp = [=](const std::string &) {
+        *statement = make();
+        return statement->syntax().isValid();
+    };
+    benchmarkCase.measure = [=](size_t &numberOfItems) {
+        bool valid = true;
+        for (size_t i = 0; i < scale(); ++i) {
+            // Decorators copy the statement before tampering it.
+            Statement copied = *statement;
+            valid = copied.syntax().isValid() && valid;
+        }
+        numberOfItems = scale();
+        return valid;
+    };
+    benchmarkCase.tearDown = [=]() { *statement = Statement(); };
+    return benchmarkCase;
+}
+
+WCDB_BENCHMARK_REGISTER([]() {
+    return makeConstructionCase("winq.construct.select.in", makeInList);
+});
+
+WCDB_BENCHMARK_REGISTER([]() {
+    return makeConstructionCase("winq.construct.insert.rows", makeMultiRowInsert);
+});
+
+WCDB_BENCHMARK_REGISTER([]() { return makeCopyCase("winq.copy.select.in", makeInList); });
+
+WCDB_BENCHMARK_REGISTER([]() {
+    return makeCopyCase("winq.copy.insert.rows", makeMultiRowInsert);
+});
+
+} // namespace Benchmark
+
+} // namespace WCDB
@@ -0,0 +1,223 @@
+//
+// Created by qiuwenchen on 2026/10/16.
+//
+
+/*
+ * Tencent is pleased to support the open source community by making
+ * WCDB available.
+ *
+ * Copyright (C) 2017 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the BSD 3-Clause License (the "License"); you may not use
+ * this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *       https://opensource.org/licenses/BSD-3-Clause
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BenchmarkSuite.hpp"
+#include "SQLWriter.hpp"
+#include "WINQ.h"
+#include <cstring>
+#include <memory>
+#include <sstream>
+
+namespace WCDB {
+
+namespace Benchmark {
+
+static StatementSelect makeSelect()
+{
+    return StatementSelect()
+    .select({ Column("id"), Column("name"), Column("score") })
+    .from("benchmark")
+    .where(Column("id") > BindParameter(1) && Column("name").like(BindParameter(2)))
+    .order(Column("score").asOrder(Order::DESC))
+    .limit(10)
+    .offset(BindParameter(3));
+}
+
+static StatementInsert makeInsert()
+{
+    return StatementInsert()
+    .insertIntoTable("benchmark")
+    .orReplace()
+    .columns({ Column("id"), Column("name"), Column("score"), Column("content") })
+    .values(BindParameter::bindParameters(4));
+}
+
+static StatementUpdate makeUpdate()
+{
+    return StatementUpdate()
+    .update("benchmark")
+    .set(Column("name"))
+    .to(BindParameter(1))
+    .set(Column("score"))
+    .to(Column("score") + 1.5)
+    .where(Column("id") == BindParameter(2));
+}
+
+// The way descriptions were generated before SQLWriter, kept as the baseline.
+static StringView describeWithStringStream(const Syntax::Identifier &syntax)
+{
+    std::ostringstream stream;
+    syntax.describle(stream);
+    return StringView(stream.str());
+}
+
+static StringView describeWithWriter(const Syntax::Identifier &syntax)
+{
+    return syntax.getDescription();
+}
+
+template<typename Statement>
+static Case makeDescriptionCase(const std::string &name,
+                                Statement (*make)(),
+                                StringView (*describe)(const Syntax::Identifier &))
+{
+    auto statement = std::make_shared<Statement>();
+    Case benchmarkCase;
+    benchmarkCase.name = name;
+    benchmarkCase.setUp = [=](const std::string &) {
+        *statement = make();
+        return describeWithStringStream(statement->syntax())
+               == describeWithWriter(statement->syntax());
+    };
+    benchmarkCase.measure = [=](size_t &numberOfItems) {
+        size_t length = 0;
+        // `SQL::getDescription` caches the description, so the syntax is described directly.
+        for (size_t i = 0; i < scale(); ++i) {
+            length += describe(statement->syntax()).length();
+        }
+        numberOfItems = scale();
+        return length > 0;
+    };
+    benchmarkCase.tearDown = [=]() { *statement = Statement(); };
+    return benchmarkCase;
+}
+
+WCDB_BENCHMARK_REGISTER([]() {
+    return makeDescriptionCase("winq.describe.select.ostringstream", makeSelect, describeWithStringStream);
+});
+
+WCDB_BENCHMARK_REGISTER([]() {
+    return makeDescriptionCase("winq.describe.select.writer", makeSelect, describeWithWriter);
+});
+
+WCDB_BENCHMARK_REGISTER([]() {
+    return makeDescriptionCase("winq.describe.insert.ostringstream", makeInsert, describeWithStringStream);
+});
+
+WCDB_BENCHMARK_REGISTER([]() {
+    return makeDescriptionCase("winq.describe.insert.writer", makeInsert, describeWithWriter);
+});
+
+WCDB_BENCHMARK_REGISTER([]() {
+    return makeDescriptionCase("winq.describe.update.ostringstream", makeUpdate, describeWithStringStream);
+});
+
+WCDB_BENCHMARK_REGISTER([]() {
+    return makeDescriptionCase("winq.describe.update.writer", makeUpdate, describeWithWriter);
+});
+
+// What a handle does to find the prepared statement of a WINQ statement rebuilt per call,
+// by describing it and by fingerprinting its syntax.
+static StringView descriptionOf(const Statement &statement)
+{
+    return statement.getDescription();
+}
+
+static StringView fingerprintOf(const Statement &statement)
+{
+    Syntax::FingerprintWriter writer;
+    writer.writeTree(statement.syntax());
+    return StringView(writer.written());
+}
+
+static bool lookUpByDescription(const Statement &statement, const UnsafeStringView &cached)
+{
+    StringView sql = statement.getDescription();
+    return sql.hash() == cached.hash() && sql.equal(cached);
+}
+
+static bool lookUpByWriter(const Statement &statement, const UnsafeStringView &cached)
+{
+    Syntax::SQLWriter writer;
+    UnsafeStringView sql = statement.getDescription(writer);
+    return sql.hash() == cached.hash() && sql.equal(cached);
+}
+
+static bool lookUpByFingerprint(const Statement &statement, const UnsafeStringView &cached)
+{
+    Syntax::FingerprintWriter writer;
+    writer.writeTree(statement.syntax());
+    UnsafeStringView fingerprint = writer.written();
+    return fingerprint.hash() == cached.hash() && fingerprint.length() == cached.length()
+           && memcmp(fingerprint.data(), cached.data(), cached.length()) == 0;
+}
+
+template<typename SpecifiedStatement>
+static Case makeLookupCase(const std::string &name,
+                           SpecifiedStatement (*make)(),
+                           StringView (*keyOf)(const Statement &),
+                           bool (*lookUp)(const Statement &, const UnsafeStringView &))
+{
+    auto statement = std::make_shared<SpecifiedStatement>();
+    auto cached = std::make_shared<StringView>();
+    Case benchmarkCase;
+    benchmarkCase.name = name;
+    benchmarkCase.setUp = [=](const std::string &) {
+        *cached = keyOf(make());
+        return !cached->empty();
+    };
+    benchmarkCase.measure = [=](size_t &numberOfItems) {
+        bool found = true;
+        for (size_t i = 0; i < scale(); ++i) {
+            // Rebuilt per call, just like the chain calls do.
+            *statement = make();
+            found = lookUp(*statement, *cached) && found;
+        }
+        numberOfItems = scale();
+        return found;
+    };
+    benchmarkCase.tearDown = [=]() {
+        *statement = SpecifiedStatement();
+        *cached = StringView();
+    };
+    return benchmarkCase;
+}
+
+WCDB_BENCHMARK_REGISTER([]() {
+    return makeLookupCase("winq.lookup.select.description", makeSelect, descriptionOf, lookUpByDescription);
+});
+
+WCDB_BENCHMARK_REGISTER([]() {
+    return makeLookupCase("winq.lookup.select.writer", makeSelect, descriptionOf, lookUpByWriter);
+});
+
+WCDB_BENCHMARK_REGISTER([]() {
+    return makeLookupCase("winq.lookup.select.fingerprint", makeSelect, fingerprintOf, lookUpByFingerprint);
+});
+
+WCDB_BENCHMARK_REGISTER([]() {
+    return makeLookupCase("winq.lookup.insert.description", makeInsert, descriptionOf, lookUpByDescription);
+});
+
+WCDB_BENCHMARK_REGISTER([]() {
+    return makeLookupCase("winq.lookup.insert.writer", makeInsert, descriptionOf, lookUpByWriter);
+});
+
+WCDB_BENCHMARK_REGISTER([]() {
+    return makeLookupCase("winq.lookup.insert.fingerprint", makeInsert, fingerprintOf, lookUpByFingerprint);
+});
+
+} // namespace Benchmark
+
+} // namespace WCDB
@@ -0,0 +1,91 @@
+//
+// Created by qiuwenchen on 2026/10/16.
+//
+
+/*
+ * Tencent is pleased to support the open source community by making
+ * WCDB available.
+ *
+ * Copyright (C) 2017 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the BSD 3-Clause License (the "License"); you may not use
+ * this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *       https://opensource.org/licenses/BSD-3-Clause
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BenchmarkSuite.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+static void printUsage(const char *program)
+{
+    fprintf(stderr,
+            "Usage: %s --directory <dir> [--output <file.json>] [--filter <name>] "
+            "[--iterations <n>] [--scale <rows>]\n",
+            program);
+}
+
+int main(int argc, char *argv[])
+{
+    WCDB::Benchmark::Options options;
+    options.directory = "wcdb_benchmark";
+    for (int i = 1; i < argc; ++i) {
+        const char *argument = argv[i];
+        const char *value = i + 1 < argc ? argv[i + 1] : nullptr;
+        if (value == nullptr) {
+            printUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+        if (strcmp(argument, "--directory") == 0) {
+            options.directory = value;
+        } else if (strcmp(argument, "--output") == 0) {
+            options.output = value;
+        } else if (strcmp(argument, "--filter") == 0) {
+            options.filter = value;
+        } else if (strcmp(argument, "--iterations") == 0) {
+            options.iterations = strtoul(value, nullptr, 10);
+        } else if (strcmp(argument, "--scale") == 0) {
+            options.scale = strtoul(value, nullptr, 10);
+        } else {
+            printUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+        ++i;
+    }
+    if (options.iterations == 0 || options.scale == 0) {
+        printUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+    WCDB::Benchmark::setScale(options.scale);
+
+    std::vector<WCDB::Benchmark::Result> results
+    = WCDB::Benchmark::Suite::shared().run(options);
+    std::string json = WCDB::Benchmark::Suite::toJSON(results);
+    if (options.output.empty()) {
+        fputs(json.c_str(), stdout);
+    } else {
+        std::ofstream file(options.output);
+        file << json;
+        if (!file.good()) {
+            fprintf(stderr, "Failed to write %s\n", options.output.c_str());
+            return EXIT_FAILURE;
+        }
+    }
+    for (const auto &result : results) {
+        if (!result.succeed) {
+            return EXIT_FAILURE;
+        }
+    }
+    return EXIT_SUCCESS;
+}
@@ -23,6 +23,8 @@
  */
 
 #import "CPPTestCase.h"
+#import "CompressionConst.hpp"
+#import "CoreConst.h"
 
 @interface CPPDatabaseTests : CPPCRUDTestCase
 
@@ -82,6 +84,70 @@
     TestCaseAssertTrue([main compare:subthread] == NSOrderedAscending);
 }
 
+- (void)test_single_writer_mode
+{
+    TestCaseAssertTrue(self.database->execute(WCDB::StatementCreateTable().createTable("fifo").define(WCDB::ColumnDef("value", WCDB::ColumnType::Integer))));
+    self.database->enableSingleWriterMode(true);
+
+    std::mutex lock;
+    std::set<const void*> writers;
+    self.database->traceSQL([&](long, const WCDB::UnsafeStringView&, const void* handle, const WCDB::UnsafeStringView& sql, const WCDB::UnsafeStringView&) {
+        if (sql.hasPrefix("INSERT")) {
+            std::lock_guard<std::mutex> lockGuard(lock);
+            writers.insert(handle);
+        }
+    });
+
+    int count = 10;
+    // Writes are queued while the writer handle is held by the transaction.
+    TestCaseAssertTrue(self.database->runTransaction([&](WCDB::Handle&) {
+        for (int i = 0; i < count; i++) {
+            [self.dispatch async:^{
+                TestCaseAssertTrue(self.database->execute(WCDB::StatementInsert().insertIntoTable("fifo").column(WCDB::Column("value")).value(i)));
+            }];
+            // Make sure that the previous thread is waiting.
+            usleep(100000);
+        }
+        return true;
+    }));
+    [self.dispatch waitUntilDone];
+
+    // The writes of a handle held for writing are also routed to the writer handle.
+    {
+        WCDB::Handle handle = self.database->getHandle();
+        TestCaseAssertTrue(handle.execute(WCDB::StatementInsert().insertIntoTable("fifo").column(WCDB::Column("value")).value(count)));
+    }
+    self.database->traceSQL(nullptr);
+    TestCaseAssertTrue(writers.size() == 1);
+
+    // They are executed in the order in which they are waiting.
+    auto values = self.database->getOneColumnFromStatement(WCDB::StatementSelect().select(WCDB::Column("value")).from("fifo").order(WCDB::Column::rowid().asOrder()));
+    TestCaseAssertTrue(values.succeed() && values.value().size() == count + 1);
+    for (int i = 0; i <= count; i++) {
+        TestCaseAssertTrue(values.value()[i].intValue() == i);
+    }
+    self.database->enableSingleWriterMode(false);
+}
+
+- (void)test_group_commit
+{
+    TestCaseAssertTrue([self createValueTable]);
+    self.database->setGroupCommitWindow(0.01, 16);
+    WCDB::MultiRowsValue rows = [Random.shared autoIncrementTestCaseValuesWithCount:100];
+    for (int i = 0; i < 100; i++) {
+        [self.dispatch async:^{
+            bool succeed = self.database->runTransactionInGroup([&](WCDB::Handle &handle) {
+                return handle.insertRows(rows[i], self.columns, self.tableName.UTF8String) && i % 10 != 0;
+            });
+            TestCaseAssertTrue(succeed == (i % 10 != 0));
+        }];
+    }
+    [self.dispatch waitUntilDone];
+    auto value = self.database->getValueFromStatement(WCDB::StatementSelect().select(WCDB::Column::all().count()).from(self.tableName.UTF8String));
+    TestCaseAssertTrue(value.succeed() && value.value().intValue() == 90);
+    self.database->setGroupCommitWindow(0, 128);
+}
+
 - (void)test_readonly
 {
     WCDB::OneRowValue row = [Random.shared autoIncrementTestCaseValuesWithCount:1][0];
@@ -181,6 +247,87 @@
     }
 }
 
+- (void)test_checkpoint_statistics
+{
+    WCDB::MultiRowsValue rows = [Random.shared autoIncrementTestCaseValuesWithCount:100];
+
+    TestCaseAssertTrue([self createValueTable]);
+    for (int i = 0; i < 100; i++) {
+        TestCaseAssertTrue(self.database->insertRows(rows[i], self.columns, self.tableName.UTF8String));
+    }
+
+    auto statistics = self.database->getCheckpointStatistics();
+    TestCaseAssertTrue(statistics.maxWALFrames > 0);
+    TestCaseAssertTrue(statistics.maxWALFrames >= statistics.walFrames);
+    TestCaseAssertTrue(statistics.frameRate > 0);
+    TestCaseAssertTrue(statistics.lastDelay > 0);
+}
+
+- (void)test_operation_queue_statistics
+{
+    auto before = WCDB::Database::getOperationQueueStatistics();
+
+    TestCaseAssertTrue([self createValueTable]);
+    WCDB::MultiRowsValue rows = [Random.shared autoIncrementTestCaseValuesWithCount:1];
+    TestCaseAssertTrue(self.database->insertRows(rows[0], self.columns, self.tableName.UTF8String));
+
+    // Auto checkpoint is scheduled after commit.
+    TestCaseAssertTrue(WCDB::Database::getOperationQueueStatistics().numberOfPendingOperations > 0);
+
+    auto after = WCDB::Database::getOperationQueueStatistics();
+    NSDate* deadline = [NSDate dateWithTimeIntervalSinceNow:WCDB::OperationQueueTimeIntervalForIdleCheckpoint + self.delayForTolerance];
+    while (after.numberOfExecutedOperations == before.numberOfExecutedOperations && [deadline timeIntervalSinceNow] > 0) {
+        [NSThread sleepForTimeInterval:0.1];
+        after = WCDB::Database::getOperationQueueStatistics();
+    }
+    TestCaseAssertTrue(after.numberOfExecutedOperations > before.numberOfExecutedOperations);
+    TestCaseAssertTrue(after.totalLatency >= before.totalLatency);
+    TestCaseAssertTrue(after.maxLatency >= before.maxLatency);
+}
+
+- (void)test_checkpoint_escalated_by_reader
+{
+    WCDB::MultiRowsValue rows = [Random.shared autoIncrementTestCaseValuesWithCount:1000];
+
+    TestCaseAssertTrue([self createValueTable]);
+    TestCaseAssertTrue(self.database->insertRows(rows[0], self.columns, self.tableName.UTF8String));
+
+    // Keep a read transaction in another thread, so that the frames written later can't be checkpointed.
+    __block BOOL reading = NO;
+    __block BOOL released = NO;
+    [self.dispatch async:^{
+        TestCaseAssertTrue(self.database->execute(WCDB::StatementBegin().beginDeferred()));
+        TestCaseAssertTrue(self.database->getValueFromStatement(WCDB::StatementSelect().select(WCDB::Column::all().count()).from(self.tableName.UTF8String)).succeed());
+        reading = YES;
+        while (!released) {
+            [NSThread sleepForTimeInterval:0.1];
+        }
+        TestCaseAssertTrue(self.database->execute(WCDB::StatementRollback().rollback()));
+    }];
+    while (!reading) {
+        [NSThread sleepForTimeInterval:0.01];
+    }
+    for (int i = 1; i < 1000; i++) {
+        TestCaseAssertTrue(self.database->insertRows(rows[i], self.columns, self.tableName.UTF8String));
+    }
+
+    // The blocked checkpoints are retried and escalated to full mode.
+    NSDate* begin = [NSDate date];
+    auto statistics = self.database->getCheckpointStatistics();
+    while (statistics.fullCount == 0 && [[NSDate date] timeIntervalSinceDate:begin] < 60) {
+        [NSThread sleepForTimeInterval:1];
+        statistics = self.database->getCheckpointStatistics();
+    }
+    TestCaseAssertTrue(statistics.passiveCount >= WCDB::AutoCheckpointBlockedTimesToEscalate);
+    TestCaseAssertTrue(statistics.blockedCount >= WCDB::AutoCheckpointBlockedTimesToEscalate);
+    // Full checkpoint finishes while the reader is still alive, since its busy waiting is limited.
+    TestCaseAssertTrue(statistics.fullCount > 0);
+    TestCaseAssertTrue(statistics.blockedCount > WCDB::AutoCheckpointBlockedTimesToEscalate);
+
+    released = YES;
+    [self.dispatch waitUntilDone];
+}
+
 - (void)test_open_fail
 {
     auto database = WCDB::Database(self.directory.UTF8String);
@@ -326,6 +473,38 @@
     TestCaseAssertCPPStringEqual(migratedTable.data(), sourceTableName.UTF8String);
 }
 
+- (void)test_range_migration
+{
+    WCDB::Database sourceDatabase([self.path stringByAppendingString:@"_source"].UTF8String);
+    NSString* sourceTableName = @"sourceTable";
+    TestCaseAssertTrue(sourceDatabase.createTable<CPPTestCaseObject>(sourceTableName.UTF8String));
+    WCDB::Table<CPPTestCaseObject> sourceTable = sourceDatabase.getTable<CPPTestCaseObject>(sourceTableName.UTF8String);
+    TestCaseAssertTrue(sourceTable.insertObjects([[Random shared] testCaseObjectsWithCount:1000 startingFromIdentifier:1]));
+    sourceDatabase.close();
+
+    WCDB::Database targetDatabase(self.path.UTF8String);
+    targetDatabase.addMigration(sourceDatabase.getPath(),
+                                WCDB::UnsafeData(),
+                                [=](WCDB::Database::MigrationInfo& info) {
+                                    if (info.table.compare(self.tableName.UTF8String) == 0) {
+                                        info.sourceTable = sourceTableName.UTF8String;
+                                        info.filterCondition = WCDB_FIELD(CPPTestCaseObject::identifier) > 100;
+                                    }
+                                });
+    targetDatabase.enableRangeMigration(true);
+
+    TestCaseAssertTrue(targetDatabase.createTable<CPPTestCaseObject>(self.tableName.UTF8String));
+    WCDB::Table<CPPTestCaseObject> targetTable = targetDatabase.getTable<CPPTestCaseObject>(self.tableName.UTF8String);
+    TestCaseAssertTrue(targetTable.selectValue(WCDB::Column::all().count()).value() == 900);
+
+    while (!targetDatabase.isMigrated()) {
+        TestCaseAssertTrue(targetDatabase.stepMigration());
+    }
+    TestCaseAssertTrue(targetTable.selectValue(WCDB::Column::all().count()).value() == 900);
+    TestCaseAssertTrue(targetTable.selectValue(WCDB_FIELD(CPPTestCaseObject::identifier).min()).value() == 101);
+    TestCaseAssertTrue(sourceTable.selectValue(WCDB::Column::all().count()).value() == 100);
+}
+
 - (void)test_normal_compress
 {
     [[Random shared] setStringType:RandomStringType_English];
@@ -460,6 +639,97 @@
     [[Random shared] setStringType:RandomStringType_Default];
 }
 
+- (void)test_decompression_cache
+{
+    [[Random shared] setStringType:RandomStringType_English];
+    TestCaseAssertTrue([self createObjectTable]);
+    auto objects = [[Random shared] testCaseObjectsWithCount:10 startingFromIdentifier:1];
+    TestCaseAssertTrue(self.table.insertObjects(objects));
+    self.database->setCompression([](WCDB::Database::CompressionInfo& info) {
+        info.addZSTDNormalCompressField(WCDB_FIELD(CPPTestCaseObject::content));
+    });
+    while (!self.database->isCompressed()) {
+        TestCaseAssertTrue(self.database->stepCompression());
+    }
+
+    WCDB::Database::setDecompressionCacheBudget(1024 * 1024);
+    auto before = WCDB::Database::getDecompressionCacheStatistics();
+    [self check:CPPMultiRowValueExtract(objects)
+      isEqualTo:CPPMultiRowValueExtract([self getAllObjects])];
+    [self check:CPPMultiRowValueExtract(objects)
+      isEqualTo:CPPMultiRowValueExtract([self getAllObjects])];
+    auto after = WCDB::Database::getDecompressionCacheStatistics();
+    TestCaseAssertTrue(after.hitCount > before.hitCount);
+    TestCaseAssertTrue(after.usedMemory > 0);
+
+    WCDB::Database::setDecompressionCacheBudget(0);
+    TestCaseAssertEqual(WCDB::Database::getDecompressionCacheStatistics().usedMemory, 0);
+    [[Random shared] setStringType:RandomStringType_Default];
+}
+
+- (void)test_parallel_compress
+{
+    [[Random shared] setStringType:RandomStringType_English];
+    TestCaseAssertTrue([self createObjectTable]);
+    // Enough rows for the batch count to grow and for several batches to be split across workers.
+    auto objects = [[Random shared] testCaseObjectsWithCount:5000 startingFromIdentifier:1];
+    TestCaseAssertTrue(self.table.insertObjects(objects));
+    self.database->setCompression([](WCDB::Database::CompressionInfo& info) {
+        info.addZSTDNormalCompressField(WCDB_FIELD(CPPTestCaseObject::content));
+    });
+
+    int numberOfSteps = 0;
+    while (!self.database->isCompressed()) {
+        TestCaseAssertTrue(self.database->stepCompression());
+        ++numberOfSteps;
+    }
+    TestCaseAssertTrue(numberOfSteps > 1);
+
+    auto uncompressedCount = self.database->getValueFromStatement(WCDB::StatementSelect().select(WCDB::Column().count()).from(self.tableName.UTF8String).where(WCDB::Column("WCDB_CT_content").isNull()));
+    TestCaseAssertTrue(uncompressedCount.value() == 0);
+
+    [self check:CPPMultiRowValueExtract(objects)
+      isEqualTo:CPPMultiRowValueExtract([self getAllObjects])];
+
+    [[Random shared] setStringType:RandomStringType_Default];
+}
+
+- (void)test_train_dict_from_table
+{
+    [[Random shared] setStringType:RandomStringType_English];
+    TestCaseAssertTrue([self createObjectTable]);
+    auto objects = [[Random shared] testCaseObjectsWithCount:1000 startingFromIdentifier:1];
+    TestCaseAssertTrue(self.table.insertObjects(objects));
+
+    self.database->setCompression([](WCDB::Database::CompressionInfo& info) {
+        info.addZSTDNormalCompressField(WCDB_FIELD(CPPTestCaseObject::content));
+    });
+    while (!self.database->isCompressed()) {
+        TestCaseAssertTrue(self.database->stepCompression());
+    }
+
+    // Only compressing column can be used.
+    TestCaseAssertFalse(self.database->trainDict(self.tableName.UTF8String, WCDB_FIELD(CPPTestCaseObject::identifier), 5).succeed());
+
+    auto dict = self.database->trainDict(self.tableName.UTF8String, WCDB_FIELD(CPPTestCaseObject::content), 5, 500);
+    TestCaseAssertTrue(dict.succeed());
+    TestCaseAssertFalse(WCDB::Database::registerZSTDDict(dict.value(), 5));
+
+    TestCaseAssertFalse(self.database->isCompressed());
+    while (!self.database->isCompressed()) {
+        TestCaseAssertTrue(self.database->stepCompression());
+    }
+    WCDB::Column typeColumn(WCDB::StringView::formatted("%s%s", WCDB::CompressionColumnTypePrefix.data(), "content"));
+    int dictCompressedText = WCDBMergeCompressionType(WCDB::CompressedType::ZSTDDict, WCDB::ColumnType::Text);
+    auto count = self.database->getValueFromStatement(WCDB::StatementSelect().select(WCDB::Column().count()).from(self.tableName.UTF8String).where(typeColumn == dictCompressedText));
+    TestCaseAssertTrue(count.value().intValue() > 0);
+
+    [self check:CPPMultiRowValueExtract(objects)
+      isEqualTo:CPPMultiRowValueExtract([self getAllObjects])];
+
+    [[Random shared] setStringType:RandomStringType_Default];
+}
+
 - (void)test_load_all_data
 {
     TestCaseAssertTrue([self createObjectTable]);
@@ -200,4 +200,105 @@
     WCDB::Database::globalTraceDatabaseOperation(nullptr);
 }
 
+- (void)test_prepared_statement_cache_budget
+{
+    TestCaseAssertTrue([self createValueTable]);
+    WCDB::MultiRowsValue rows = [Random.shared testCaseValuesWithCount:10 startingFromIdentifier:0];
+    TestCaseAssertTrue(self.database->insertRows(rows, self.columns, self.tableName.UTF8String));
+    self.database->setPreparedStatementCacheBudget(2);
+
+    WCDB::Handle handle = self.database->getHandle();
+    auto stepping = handle.getOrCreatePreparedStatement(WCDB::StatementSelect().select(WCDB::Column("identifier")).from(self.tableName.UTF8String).order(WCDB::Column("identifier")));
+    TestCaseAssertTrue(stepping.succeed());
+    TestCaseAssertTrue(stepping.value().step());
+    TestCaseAssertTrue(stepping.value().getInteger() == 0);
+
+    auto held = handle.getOrCreatePreparedStatement(WCDB::StatementSelect().select(WCDB::Column("identifier")).from(self.tableName.UTF8String).where(WCDB::Column("identifier") == WCDB::BindParameter(1)));
+    TestCaseAssertTrue(held.succeed());
+    held.value().bindInteger(5);
+
+    // Each statement here is released after use, so it will be evicted to keep the budget.
+    for (int i = 0; i < 10; i++) {
+        auto statement = handle.getOrCreatePreparedStatement(WCDB::StatementSelect().select(i).from(self.tableName.UTF8String).limit(1));
+        TestCaseAssertTrue(statement.succeed());
+        TestCaseAssertTrue(statement.value().step());
+        TestCaseAssertTrue(statement.value().getInteger() == i);
+        statement.value().reset();
+    }
+
+    // The statement being stepped should not be evicted.
+    TestCaseAssertTrue(stepping.value().step());
+    TestCaseAssertTrue(stepping.value().getInteger() == 1);
+    stepping.value().reset();
+
+    // The statement held by caller should not be evicted, so its bindings are kept.
+    TestCaseAssertTrue(held.value().step());
+    TestCaseAssertTrue(held.value().getInteger() == 5);
+    held.value().reset();
+    handle.invalidate();
+    self.database->setPreparedStatementCacheBudget(0);
+}
+
+- (void)test_prepared_statement_fingerprint
+{
+    TestCaseAssertTrue([self createValueTable]);
+    WCDB::MultiRowsValue rows = [Random.shared testCaseValuesWithCount:10 startingFromIdentifier:0];
+    TestCaseAssertTrue(self.database->insertRows(rows, self.columns, self.tableName.UTF8String));
+
+    WCDB::Handle handle = self.database->getHandle();
+    const char* table = self.tableName.UTF8String;
+    // Rebuilt per call, so that the second round is looked up by the fingerprints of the first one.
+    for (int round = 0; round < 2; round++) {
+        auto integer = handle.getOrCreatePreparedStatement(WCDB::StatementSelect().select(1).from(table).limit(1));
+        TestCaseAssertTrue(integer.succeed() && integer.value().step());
+        TestCaseAssertEqual(integer.value().getType(), WCDB::ColumnType::Integer);
+        integer.value().reset();
+
+        auto text = handle.getOrCreatePreparedStatement(WCDB::StatementSelect().select("1").from(table).limit(1));
+        TestCaseAssertTrue(text.succeed() && text.value().step());
+        TestCaseAssertEqual(text.value().getType(), WCDB::ColumnType::Text);
+        text.value().reset();
+
+        for (const char* alias : { "a", "b" }) {
+            auto aliased = handle.getOrCreatePreparedStatement(WCDB::StatementSelect().select(WCDB::Column("identifier").as(alias)).from(table).limit(1));
+            TestCaseAssertTrue(aliased.succeed());
+            TestCaseAssertTrue(aliased.value().getColumnName(0).equal(alias));
+        }
+
+        for (int identifier : { 2, 3 }) {
+            auto condition = handle.getOrCreatePreparedStatement(WCDB::StatementSelect().select(WCDB::Column("identifier")).from(table).where(WCDB::Column("identifier") == identifier));
+            TestCaseAssertTrue(condition.succeed() && condition.value().step());
+            TestCaseAssertEqual(condition.value().getInteger(), identifier);
+            condition.value().reset();
+        }
+
+        // The statements that differ only in structure must not share the same fingerprint.
+        for (bool ascending : { true, false }) {
+            auto ordered = handle.getOrCreatePreparedStatement(WCDB::StatementSelect().select(WCDB::Column("identifier")).from(table).order(WCDB::Column("identifier").asOrder(ascending ? WCDB::Order::ASC : WCDB::Order::DESC)).limit(1));
+            TestCaseAssertTrue(ordered.succeed() && ordered.value().step());
+            TestCaseAssertEqual(ordered.value().getInteger(), ascending ? 0 : 9);
+            ordered.value().reset();
+        }
+
+        auto limited = handle.getOrCreatePreparedStatement(WCDB::StatementSelect().select(WCDB::Column("identifier")).from(table).order(WCDB::Column("identifier")).limit(1));
+        TestCaseAssertTrue(limited.succeed() && limited.value().step());
+        TestCaseAssertEqual(limited.value().getInteger(), 0);
+        limited.value().reset();
+
+        auto offset = handle.getOrCreatePreparedStatement(WCDB::StatementSelect().select(WCDB::Column("identifier")).from(table).order(WCDB::Column("identifier")).limit(1).offset(1));
+        TestCaseAssertTrue(offset.succeed() && offset.value().step());
+        TestCaseAssertEqual(offset.value().getInteger(), 1);
+        offset.value().reset();
+
+        for (bool greater : { true, false }) {
+            WCDB::Expression condition = greater ? WCDB::Column("identifier") > 5 : WCDB::Column("identifier") < 5;
+            auto compared = handle.getOrCreatePreparedStatement(WCDB::StatementSelect().select(WCDB::Column("identifier")).from(table).where(condition).order(WCDB::Column("identifier")).limit(1));
+            TestCaseAssertTrue(compared.succeed() && compared.value().step());
+            TestCaseAssertEqual(compared.value().getInteger(), greater ? 6 : 0);
+            compared.value().reset();
+        }
+    }
+    handle.invalidate();
+}
+
 @end
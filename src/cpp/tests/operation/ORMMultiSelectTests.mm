@@ -184,4 +184,44 @@
                  }];
 }
 
+#pragma mark - Stream
+- (WCDB::MultiSelect)prepareMultiSelect
+{
+    WCDB::ResultFields resultColumns
+    = CPPTestCaseObject::allFields()
+      .redirect([self](const WCDB::Field& field) -> WCDB::ResultColumn {
+          return field.table(self.tableName.UTF8String);
+      })
+      .addingNewResultColumns(CPPTestCaseObject::allFields().redirect([self](const WCDB::Field& field) -> WCDB::ResultColumn {
+          return field.table(self.tableName2.UTF8String);
+      }));
+    return self.database->prepareMultiSelect().onResultFields(resultColumns).fromTables({ self.tableName.UTF8String, self.tableName2.UTF8String }).where(WCDB_FIELD(CPPTestCaseObject::identifier).table(self.tableName.UTF8String) == WCDB_FIELD(CPPTestCaseObject::identifier).table(self.tableName2.UTF8String));
+}
+
+- (void)test_enumerate_multi_objects
+{
+    WCDB::MultiSelect select = [self prepareMultiSelect];
+    WCDB::ValueArray<CPPTestCaseObject> objects;
+    TestCaseAssertTrue(select.enumerateMultiObjects([&](WCDB::MultiObject& multiObject) {
+        objects.push_back(multiObject.objectAtTable<CPPTestCaseObject>(self.tableName.UTF8String).value());
+        TestCaseAssertTrue(multiObject.objectAtTable<CPPTestCaseObject>(self.tableName2.UTF8String).succeed());
+        return true;
+    }));
+    TestCaseAssertTrue(objects.size() == 2 && objects[0] == self.object1 && objects[1] == self.object2);
+}
+
+- (void)test_multi_select_next_batch
+{
+    WCDB::MultiSelect select = [self prepareMultiSelect];
+    WCDB::ValueArray<WCDB::MultiObject> multiObjects;
+    TestCaseAssertTrue(select.nextBatch(multiObjects, 1));
+    TestCaseAssertEqual(multiObjects.size(), 1);
+    TestCaseAssertTrue(self.object1 == multiObjects[0].objectAtTable<CPPTestCaseObject>(self.tableName.UTF8String).value());
+    TestCaseAssertTrue(select.nextBatch(multiObjects, 2));
+    TestCaseAssertEqual(multiObjects.size(), 1);
+    TestCaseAssertTrue(self.object2 == multiObjects[0].objectAtTable<CPPTestCaseObject>(self.tableName.UTF8String).value());
+    TestCaseAssertTrue(select.nextBatch(multiObjects, 2));
+    TestCaseAssertEqual(multiObjects.size(), 0);
+}
+
 @end
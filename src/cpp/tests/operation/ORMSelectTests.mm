@@ -1175,4 +1175,43 @@
          }];
 }
 
+#pragma mark - Select - Stream
+- (void)test_select_enumerate_objects
+{
+    WCDB::Select<CPPTestCaseObject> select = self.database->prepareSelect<CPPTestCaseObject>().fromTable(self.tableName.UTF8String);
+    WCDB::ValueArray<CPPTestCaseObject> objects;
+    const CPPTestCaseObject* reused = nullptr;
+    TestCaseAssertTrue(select.enumerateObjects([&](CPPTestCaseObject& object) {
+        TestCaseAssertTrue(reused == nullptr || reused == &object);
+        reused = &object;
+        objects.push_back(object);
+        return true;
+    }));
+    TestCaseAssertTrue(objects.size() == 2 && objects[0] == self.object1 && objects[1] == self.object2);
+}
+
+- (void)test_select_enumerate_objects_stop
+{
+    WCDB::Select<CPPTestCaseObject> select = self.database->prepareSelect<CPPTestCaseObject>().fromTable(self.tableName.UTF8String);
+    int count = 0;
+    TestCaseAssertTrue(select.enumerateObjects([&](CPPTestCaseObject& object) {
+        TestCaseAssertTrue(object == self.object1);
+        ++count;
+        return false;
+    }));
+    TestCaseAssertEqual(count, 1);
+}
+
+- (void)test_select_next_batch
+{
+    WCDB::Select<CPPTestCaseObject> select = self.database->prepareSelect<CPPTestCaseObject>().fromTable(self.tableName.UTF8String);
+    WCDB::ValueArray<CPPTestCaseObject> objects;
+    TestCaseAssertTrue(select.nextBatch(objects, 1));
+    TestCaseAssertTrue(objects.size() == 1 && objects[0] == self.object1);
+    TestCaseAssertTrue(select.nextBatch(objects, 2));
+    TestCaseAssertTrue(objects.size() == 1 && objects[0] == self.object2);
+    TestCaseAssertTrue(select.nextBatch(objects, 2));
+    TestCaseAssertEqual(objects.size(), 0);
+}
+
 @end
@@ -344,4 +344,69 @@
     }
 }
 
+#pragma mark - Row View
+- (void)test_row_view
+{
+    WCDB::StatementSelect statement = WCDB::StatementSelect().select(self.resultColumns).from(self.tableName.UTF8String);
+    TestCaseAssertTrue(self.handle->prepare(statement));
+    WCDB::MultiRowsValue rows;
+    TestCaseAssertTrue(self.handle->enumerateRows([&](const WCDB::RowView& rowView) {
+        TestCaseAssertEqual(rowView.getNumberOfColumns(), 2);
+        auto row = rowView.getTuple<int64_t, WCDB::UnsafeStringView>();
+        rows.push_back({ std::get<0>(row), WCDB::StringView(std::get<1>(row)) });
+        TestCaseAssertEqual(rowView.get<int>(0), rowView.getInteger(0));
+        TestCaseAssertCPPStringEqual(rowView.get<std::string>(1).c_str(), rowView.getText(1).data());
+        return true;
+    }));
+    TestCaseAssertTrue(self.handle->done());
+    TestCaseAssertTrue(rows == self.rows);
+    self.handle->finalize();
+}
+
+- (void)test_row_view_stop
+{
+    WCDB::StatementSelect statement = WCDB::StatementSelect().select(self.resultColumns).from(self.tableName.UTF8String);
+    TestCaseAssertTrue(self.handle->prepare(statement));
+    int count = 0;
+    TestCaseAssertTrue(self.handle->enumerateRows([&](const WCDB::RowView&) {
+        ++count;
+        return false;
+    }));
+    TestCaseAssertEqual(count, 1);
+    TestCaseAssertFalse(self.handle->done());
+    TestCaseAssertEqual(self.handle->getRowView().getInteger(0), self.rows[0][0].intValue());
+    self.handle->finalize();
+}
+
+- (void)test_invalid_row_view
+{
+    TestCaseAssertTrue(self.handle->getRowView().isValid());
+    WCDB::RowView rowView(nullptr);
+    TestCaseAssertFalse(rowView.isValid());
+    TestCaseAssertEqual(rowView.getNumberOfColumns(), 0);
+    TestCaseAssertTrue(rowView.isNull(0));
+    TestCaseAssertEqual(rowView.getInteger(0), 0);
+    TestCaseAssertTrue(rowView.getText(0).empty());
+}
+
+#pragma mark - Columnar Batch
+- (void)test_fetch_batch
+{
+    WCDB::StatementSelect statement = WCDB::StatementSelect().select(self.resultColumns).from(self.tableName.UTF8String);
+    TestCaseAssertTrue(self.handle->prepare(statement));
+    std::vector<int64_t> identifiers;
+    WCDB::ColumnArena contents;
+    WCDB::ColumnarBatch batch;
+    batch.integers(0, identifiers).texts(1, contents);
+    WCDB::MultiRowsValue rows;
+    while (self.handle->fetchBatch(batch, 1) && batch.getNumberOfRows() > 0) {
+        TestCaseAssertEqual(identifiers.size(), 1);
+        TestCaseAssertEqual(contents.size(), 1);
+        rows.push_back({ identifiers[0], WCDB::StringView(contents[0]) });
+    }
+    TestCaseAssertTrue(self.handle->done());
+    TestCaseAssertTrue(rows == self.rows);
+    self.handle->finalize();
+}
+
 @end
@@ -96,11 +96,12 @@
     if (dbHandle == nil) {
         return nil;
     }
-    WCDB::HandleStatement *preparedHandleStatement = dbHandle->getOrCreatePreparedStatement(statement);
+    WCDB::AbstractHandle::PreparedStatementReference reference;
+    WCDB::HandleStatement *preparedHandleStatement = dbHandle->getOrCreatePreparedStatement(statement, reference);
     if (preparedHandleStatement == nullptr) {
         return nullptr;
     }
-    return [[WCTPreparedStatement alloc] initWithHandleStatement:preparedHandleStatement];
+    return [[WCTPreparedStatement alloc] initWithHandleStatement:preparedHandleStatement andReference:reference];
 }
 
 - (void)finalizeAllStatements
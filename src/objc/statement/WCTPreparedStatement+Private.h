@@ -28,7 +28,11 @@
 WCDB_API @interface WCTPreparedStatement() {
 @private
     WCDB::HandleStatement* _handleStatement;
+    // The cached statement is kept prepared while it's referenced.
+    WCDB::AbstractHandle::PreparedStatementReference _reference;
 }
 - (instancetype)initWithHandleStatement:(WCDB::HandleStatement*)handlesStatement;
+- (instancetype)initWithHandleStatement:(WCDB::HandleStatement*)handlesStatement
+                           andReference:(const WCDB::AbstractHandle::PreparedStatementReference&)reference;
 - (WCDB::HandleStatement*)getRawHandleStatement;
 @end
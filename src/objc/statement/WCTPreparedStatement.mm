@@ -34,9 +34,16 @@
 @implementation WCTPreparedStatement
 
 - (instancetype)initWithHandleStatement:(WCDB::HandleStatement *)handlesStatement
+{
+    return [self initWithHandleStatement:handlesStatement andReference:nullptr];
+}
+
+- (instancetype)initWithHandleStatement:(WCDB::HandleStatement *)handlesStatement
+                           andReference:(const WCDB::AbstractHandle::PreparedStatementReference &)reference
 {
     if (self = [super init]) {
         _handleStatement = handlesStatement;
+        _reference = reference;
     }
     return self;
 }
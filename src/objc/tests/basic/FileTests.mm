@@ -47,6 +47,7 @@
         database.firstMaterialPath,
         database.lastMaterialPath,
         database.incrementalMaterialPath,
+        database.materialLogPath,
         [database.factoryRestorePath stringByAppendingPathComponent:path.lastPathComponent],
         database.journalPath,
         database.shmPath,
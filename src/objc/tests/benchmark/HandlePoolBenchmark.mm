@@ -0,0 +1,148 @@
+//
+// Created by qiuwenchen on 2026/10/16.
+//
+
+/*
+ * Tencent is pleased to support the open source community by making
+ * WCDB available.
+ *
+ * Copyright (C) 2017 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the BSD 3-Clause License (the "License"); you may not use
+ * this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *       https://opensource.org/licenses/BSD-3-Clause
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#import "TestCase.h"
+#import <Foundation/Foundation.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+@interface HandlePoolBenchmark : Benchmark
+
+@end
+
+@implementation HandlePoolBenchmark
+
+- (void)doTestGetHandleWithThreadCount:(int)threadCount
+{
+    int numberOfGetsPerThread = 100000 / threadCount;
+    __block BOOL result;
+    [self
+    doMeasure:^{
+        std::vector<std::thread> threads;
+        std::atomic<bool> succeed(true);
+        for (int i = 0; i < threadCount; ++i) {
+            threads.emplace_back([&]() {
+                for (int j = 0; j < numberOfGetsPerThread; ++j) {
+                    WCTHandle* handle = [self.database getHandle];
+                    if (handle == nil) {
+                        succeed = false;
+                    }
+                    [handle invalidate];
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        result = succeed;
+    }
+    setUp:^{
+        TestCaseAssertTrue([self.database canOpen]);
+    }
+    tearDown:^{
+        [self.database close];
+        result = NO;
+    }
+    checkCorrectness:^{
+        TestCaseAssertTrue(result);
+    }];
+}
+
+- (void)doTestPointQueryWithThreadCount:(int)threadCount
+{
+    int numberOfQueriesPerThread = 100000 / threadCount;
+    __block BOOL result;
+    [self
+    doMeasure:^{
+        std::vector<std::thread> threads;
+        std::atomic<bool> succeed(true);
+        for (int i = 0; i < threadCount; ++i) {
+            threads.emplace_back([&]() {
+                for (int j = 0; j < numberOfQueriesPerThread; ++j) {
+                    WCTValue* value = [self.database getValueFromStatement:WCDB::StatementSelect().select(1)];
+                    if (value.numberValue.intValue != 1) {
+                        succeed = false;
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        result = succeed;
+    }
+    setUp:^{
+        TestCaseAssertTrue([self.database canOpen]);
+    }
+    tearDown:^{
+        [self.database close];
+        result = NO;
+    }
+    checkCorrectness:^{
+        TestCaseAssertTrue(result);
+    }];
+}
+
+- (void)test_get_handle_with_1_thread
+{
+    [self doTestGetHandleWithThreadCount:1];
+}
+
+- (void)test_get_handle_with_8_threads
+{
+    [self doTestGetHandleWithThreadCount:8];
+}
+
+- (void)test_get_handle_with_32_threads
+{
+    [self doTestGetHandleWithThreadCount:32];
+}
+
+- (void)test_get_handle_with_64_threads
+{
+    [self doTestGetHandleWithThreadCount:64];
+}
+
+- (void)test_point_query_with_1_thread
+{
+    [self doTestPointQueryWithThreadCount:1];
+}
+
+- (void)test_point_query_with_8_threads
+{
+    [self doTestPointQueryWithThreadCount:8];
+}
+
+- (void)test_point_query_with_32_threads
+{
+    [self doTestPointQueryWithThreadCount:32];
+}
+
+- (void)test_point_query_with_64_threads
+{
+    [self doTestPointQueryWithThreadCount:64];
+}
+
+@end
@@ -41,6 +41,7 @@ typedef NSData* _Nonnull (^WCTCorruptDataBlock)(int size);
 @property (nonatomic, readonly) NSString* incrementalMaterialPath;
 @property (nonatomic, readonly) NSString* firstMaterialPath;
 @property (nonatomic, readonly) NSString* lastMaterialPath;
+@property (nonatomic, readonly) NSString* materialLogPath;
 @property (nonatomic, readonly) NSString* journalPath;
 @property (nonatomic, readonly) NSString* shmPath;
 @property (nonatomic, readonly) NSString* factoryRestorePath;
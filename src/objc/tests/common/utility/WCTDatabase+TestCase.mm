@@ -55,6 +55,11 @@
     return [self.path stringByAppendingString:@"-last.material"];
 }
 
+- (NSString *)materialLogPath
+{
+    return [self.path stringByAppendingString:@"-log.material"];
+}
+
 - (NSString *)factoryPath
 {
     return [self.path stringByAppendingString:@".factory"];
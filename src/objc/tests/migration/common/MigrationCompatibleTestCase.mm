@@ -185,7 +185,7 @@
 
 - (void)doTestSelect
 {
-    NSString* sql = @"SELECT identifier, content FROM temp.wcdb_union_testTable WHERE identifier == 1 ORDER BY rowid ASC";
+    NSString* sql = [NSString stringWithFormat:@"SELECT wcdb_column_0 AS identifier, wcdb_column_1 AS content FROM (SELECT * FROM (SELECT identifier AS wcdb_column_0, content AS wcdb_column_1, rowid AS wcdb_order_0 FROM main.testTable WHERE identifier == 1) UNION ALL SELECT * FROM (SELECT identifier AS wcdb_column_0, content AS wcdb_column_1, rowid AS wcdb_order_0 FROM %@%@ WHERE identifier == 1)) ORDER BY wcdb_order_0 ASC", self.schemaName, self.sourceTable];
 
     [self doTestObjects:@[ self.objects.firstObject ]
                  andSQL:sql
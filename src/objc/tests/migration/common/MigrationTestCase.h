@@ -53,4 +53,9 @@
 - (void)configMigration;
 - (void)clearData;
 
+- (NSString*)sqlForDualReadingWhere:(NSString*)condition
+                            orderBy:(NSString*)column
+                              order:(NSString*)order
+                              limit:(NSString*)limit;
+
 @end
@@ -274,6 +274,34 @@
     }
 }
 
+- (NSString*)sqlForDualReadingWhere:(NSString*)condition
+                            orderBy:(NSString*)column
+                              order:(NSString*)order
+                              limit:(NSString*)limit
+{
+    NSString* sourceCondition = condition;
+    if (self.needFilter) {
+        NSString* filter = [NSString stringWithFormat:@"%@%@.classification == %d", self.schemaName, self.sourceTableName, MigrationClassificationB];
+        sourceCondition = condition.length > 0 ? [NSString stringWithFormat:@"(%@) AND (%@)", condition, filter] : filter;
+    }
+    NSString* branchTail = limit.length > 0 ? [NSString stringWithFormat:@" ORDER BY %@ %@ LIMIT %@", column, order, limit] : @"";
+    NSString* (^branch)(NSString*, NSString*) = ^NSString*(NSString* table, NSString* where) {
+        return [NSString stringWithFormat:@"SELECT * FROM (SELECT identifier AS wcdb_column_0, content AS wcdb_column_1, %@ AS wcdb_order_0 FROM %@%@%@)",
+                                          column,
+                                          table,
+                                          where.length > 0 ? [NSString stringWithFormat:@" WHERE %@", where] : @"",
+                                          branchTail];
+    };
+    NSString* sql = [NSString stringWithFormat:@"SELECT wcdb_column_0 AS identifier, wcdb_column_1 AS content FROM (%@ UNION ALL %@) ORDER BY wcdb_order_0 %@",
+                                               branch([NSString stringWithFormat:@"main.%@", self.tableName], condition),
+                                               branch([NSString stringWithFormat:@"%@%@", self.schemaName, self.sourceTableName], sourceCondition),
+                                               order];
+    if (limit.length > 0) {
+        sql = [sql stringByAppendingFormat:@" LIMIT %@", limit];
+    }
+    return sql;
+}
+
 - (NSArray<NSObject<WCTTableCoding>*>*)getAllObjects
 {
     return [self.table getObjectsOrders:[self.targetClass identifier].asOrder(WCTOrderedAscending)];
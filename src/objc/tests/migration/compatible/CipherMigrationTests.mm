@@ -46,7 +46,7 @@
 - (void)test_cipher
 {
     NSObject<MigrationTestObject>* expectedObject = self.filterObjects.lastObject;
-    NSString* sql = [NSString stringWithFormat:@"SELECT identifier, content FROM temp.wcdb_union_testTable WHERE identifier == %d ORDER BY rowid ASC", expectedObject.identifier];
+    NSString* sql = [self sqlForDualReadingWhere:[NSString stringWithFormat:@"identifier == %d", expectedObject.identifier] orderBy:@"rowid" order:@"ASC" limit:nil];
 
     [self doTestObjects:@[ expectedObject ]
                  andSQL:sql
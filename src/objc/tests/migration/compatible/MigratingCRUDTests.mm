@@ -336,7 +336,7 @@
     TestCaseLog(@"Start test select");
     [self doTestMigration:^{
         NSObject<MigrationTestObject>* expectedObject = self.filterObjects.lastObject;
-        NSString* sql = [NSString stringWithFormat:@"SELECT identifier, content FROM temp.wcdb_union_testTable WHERE identifier == %d ORDER BY rowid ASC", expectedObject.identifier];
+        NSString* sql = [self sqlForDualReadingWhere:[NSString stringWithFormat:@"identifier == %d", expectedObject.identifier] orderBy:@"rowid" order:@"ASC" limit:nil];
 
         [self doTestObjects:@[ expectedObject ]
                      andSQL:sql
@@ -344,7 +344,7 @@
                     return [self.table getObjectsWhere:[self.targetClass identifier] == expectedObject.identifier];
                 }];
 
-        sql = @"SELECT identifier, content FROM temp.wcdb_union_testTable ORDER BY identifier DESC LIMIT 1";
+        sql = [self sqlForDualReadingWhere:nil orderBy:@"identifier" order:@"DESC" limit:@"1"];
 
         [self doTestObjects:@[ expectedObject ]
                      andSQL:sql
@@ -354,6 +354,121 @@
     }];
 }
 
+- (void)test_select_multiple_rows_across_branches
+{
+    TestCaseLog(@"Start test select multiple rows across branches");
+    [self doTestMigration:^{
+        // The rows are in both of the source table and the target table after migration is started.
+        NSArray<NSObject<MigrationTestObject>*>* expectedObjects = self.filterObjects.reversedArray;
+        NSArray<NSObject<WCTTableCoding>*>* objects = [self.table getObjectsOrders:[self.targetClass identifier].asOrder(WCTOrderedDescending)];
+        TestCaseAssertTrue([objects isEqualToArray:expectedObjects]);
+
+        int bound = expectedObjects[expectedObjects.count / 2].identifier;
+        NSRange range = NSMakeRange(0, expectedObjects.count / 2);
+        objects = [self.table getObjectsWhere:[self.targetClass identifier] > bound
+                                       orders:[self.targetClass identifier].asOrder(WCTOrderedDescending)];
+        TestCaseAssertTrue([objects isEqualToArray:[expectedObjects subarrayWithRange:range]]);
+    }];
+}
+
+- (void)test_select_with_limit_and_offset
+{
+    TestCaseLog(@"Start test select with limit and offset");
+    [self doTestMigration:^{
+        NSArray<NSObject<MigrationTestObject>*>* expectedObjects = self.filterObjects;
+        int count = (int) expectedObjects.count;
+        // The windows at the head, in the middle and at the tail, where the rows come from different branches.
+        for (NSNumber* offset in @[ @(0), @(count / 2 - 5), @(count - 5) ]) {
+            NSArray<NSObject<WCTTableCoding>*>* objects = [self.table getObjectsOrders:[self.targetClass identifier].asOrder(WCTOrderedAscending)
+                                                                                 limit:10
+                                                                                offset:offset.intValue];
+            NSRange range = NSMakeRange(offset.intValue, MIN(10, count - offset.intValue));
+            TestCaseAssertTrue([objects isEqualToArray:[expectedObjects subarrayWithRange:range]]);
+        }
+
+        // Negative limit means no limit.
+        NSArray<NSObject<WCTTableCoding>*>* objects = [self.table getObjectsOrders:[self.targetClass identifier].asOrder(WCTOrderedAscending)
+                                                                             limit:-1
+                                                                            offset:count - 5];
+        TestCaseAssertTrue([objects isEqualToArray:[expectedObjects subarrayWithRange:NSMakeRange(count - 5, 5)]]);
+    }];
+}
+
+- (void)test_select_referencing_alias
+{
+    TestCaseLog(@"Start test select referencing alias");
+    [self doTestMigration:^{
+        NSArray<NSObject<MigrationTestObject>*>* expectedObjects = self.filterObjects;
+        int bound = expectedObjects[expectedObjects.count / 2].identifier;
+        NSMutableArray<NSNumber*>* expectedIdentifiers = [NSMutableArray array];
+        for (NSObject<MigrationTestObject>* object in expectedObjects.reverseObjectEnumerator) {
+            if (object.identifier > bound && expectedIdentifiers.count < 10) {
+                [expectedIdentifiers addObject:@(object.identifier)];
+            }
+        }
+
+        // The aliases of result columns can't be resolved in branches, so the unioned view is used.
+        WCDB::Column alias("aliasId");
+        NSString* sql = [NSString stringWithFormat:@"SELECT identifier AS aliasId FROM temp.wcdb_union_testTable WHERE aliasId > %d ORDER BY aliasId DESC LIMIT 10", bound];
+        __block WCTOneColumn* identifiers = nil;
+        [self doTestSQLs:@[ sql ]
+             inOperation:^BOOL {
+                 identifiers = [self.database getColumnFromStatement:WCDB::StatementSelect()
+                                                                     .select([self.targetClass identifier].as("aliasId"))
+                                                                     .from(self.tableName)
+                                                                     .where(alias > bound)
+                                                                     .order(alias.asOrder(WCTOrderedDescending))
+                                                                     .limit(10)];
+                 return identifiers != nil;
+             }];
+        TestCaseAssertEqual(identifiers.count, expectedIdentifiers.count);
+        for (int i = 0; i < identifiers.count; i++) {
+            TestCaseAssertEqual(identifiers[i].numberValue.intValue, expectedIdentifiers[i].intValue);
+        }
+    }];
+}
+
+- (void)test_select_with_unnumbered_bind_parameters
+{
+    TestCaseLog(@"Start test select with unnumbered bind parameters");
+    [self doTestMigration:^{
+        NSArray<NSObject<MigrationTestObject>*>* expectedObjects = self.filterObjects;
+        int bound = expectedObjects[expectedObjects.count / 2].identifier;
+        NSMutableArray<NSNumber*>* expectedIdentifiers = [NSMutableArray array];
+        for (NSObject<MigrationTestObject>* object in expectedObjects.reverseObjectEnumerator) {
+            if (object.identifier > bound && expectedIdentifiers.count < 10) {
+                [expectedIdentifiers addObject:@(object.identifier)];
+            }
+        }
+
+        // The copies of `?` in branches can't be bound, so the unioned view is used.
+        NSString* sql = @"SELECT identifier FROM temp.wcdb_union_testTable WHERE identifier > ? ORDER BY identifier DESC LIMIT ?";
+        NSMutableArray<NSNumber*>* identifiers = [NSMutableArray array];
+        [self doTestSQLs:@[ sql ]
+             inOperation:^BOOL {
+                 WCTHandle* handle = [self.database getHandle];
+                 WCDB::StatementSelect statement = WCDB::StatementSelect()
+                                                   .select([self.targetClass identifier])
+                                                   .from(self.tableName)
+                                                   .where([self.targetClass identifier] > WCDB::BindParameter())
+                                                   .order([self.targetClass identifier].asOrder(WCTOrderedDescending))
+                                                   .limit(WCDB::BindParameter());
+                 BOOL succeed = [handle prepare:statement];
+                 if (succeed) {
+                     [handle bindInteger:bound toIndex:1];
+                     [handle bindInteger:10 toIndex:2];
+                     while ((succeed = [handle step]) && ![handle done]) {
+                         [identifiers addObject:@([handle extractIntegerAtIndex:0])];
+                     }
+                     [handle finalizeStatement];
+                 }
+                 [handle invalidate];
+                 return succeed;
+             }];
+        TestCaseAssertTrue([identifiers isEqualToArray:expectedIdentifiers]);
+    }];
+}
+
 - (void)test_drop_table
 {
     TestCaseLog(@"Start test drop table");
@@ -303,7 +303,8 @@
     TestCaseAssertTrue([self.database passiveCheckpoint]);
     usleep(10000);
 
-    TestCaseAssertTrue([self.fileManager fileExistsAtPath:self.database.lastMaterialPath]);
+    TestCaseAssertTrue([self.fileManager fileExistsAtPath:self.database.lastMaterialPath]
+                       || [self.fileManager fileExistsAtPath:self.database.materialLogPath]);
 }
 
 - (void)test_incremental_backup_interrupted
@@ -0,0 +1,207 @@
+//
+// Created by qiuwenchen on 2026/10/16.
+//
+
+/*
+ * Tencent is pleased to support the open source community by making
+ * WCDB available.
+ *
+ * Copyright (C) 2017 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the BSD 3-Clause License (the "License"); you may not use
+ * this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *       https://opensource.org/licenses/BSD-3-Clause
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#import "BackupTestCase.h"
+#import "Random+RepairTestObject.h"
+
+@interface MaterialLogTests : BackupTestCase
+
+@end
+
+@implementation MaterialLogTests
+
+- (void)setUp
+{
+    [super setUp];
+    // The base material should be large enough comparing to the blocks, so that the log is not compacted.
+    self.objectCount = 2000;
+}
+
+- (void)doFullBackup
+{
+    [self.database enableAutoCheckpoint:NO];
+    [self.database enableAutoBackup:YES];
+    TestCaseAssertTrue([self.database passiveCheckpoint]);
+    usleep(10000);
+    TestCaseAssertTrue([self.database backup]);
+    TestCaseAssertTrue([self.fileManager fileExistsAtPath:self.database.firstMaterialPath]);
+    TestCaseAssertFalse([self.fileManager fileExistsAtPath:self.database.lastMaterialPath]);
+    TestCaseAssertFalse([self.fileManager fileExistsAtPath:self.database.materialLogPath]);
+}
+
+- (NSArray*)doBackupWithMaterialLog
+{
+    NSArray* objects = [[Random shared] repairObjectsWithClass:self.testClass andCount:10 startingFromIdentifier:self.objects.lastObject.identifier + 1];
+    TestCaseAssertTrue([self.table insertObjects:objects]);
+    [self.objects addObjectsFromArray:objects];
+    TestCaseAssertTrue([self.database passiveCheckpoint]);
+    usleep(10000);
+    TestCaseAssertTrue([self.database backup]);
+    TestCaseAssertTrue([self.fileManager fileExistsAtPath:self.database.materialLogPath]);
+    TestCaseAssertFalse([self.fileManager fileExistsAtPath:self.database.lastMaterialPath]);
+    return objects;
+}
+
+- (void)doTestRetrieveWithCorruptedHeader:(NSArray*)expectedObjects
+{
+    [self.database corruptPage:1];
+    TestCaseAssertTrue([self.database retrieve:nil] > 0);
+    NSArray* allObjects = [self.table getObjects];
+    TestCaseAssertTrue(allObjects.count >= expectedObjects.count);
+    [self checkObjects:expectedObjects containedIn:allObjects];
+}
+
+- (void)doTestCompactedAfterBackup
+{
+    TestCaseAssertTrue([self.database passiveCheckpoint]);
+    usleep(10000);
+    TestCaseAssertTrue([self.database backup]);
+    TestCaseAssertFalse([self.fileManager fileExistsAtPath:self.database.materialLogPath]);
+    TestCaseAssertTrue([self.fileManager fileExistsAtPath:self.database.lastMaterialPath]);
+}
+
+- (void)test_append_and_replay
+{
+    [self executeTest:^{
+        [self doFullBackup];
+        [self doBackupWithMaterialLog];
+        auto logSize = [self.fileManager attributesOfItemAtPath:self.database.materialLogPath error:nil].fileSize;
+        [self doBackupWithMaterialLog];
+        TestCaseAssertTrue([self.fileManager attributesOfItemAtPath:self.database.materialLogPath error:nil].fileSize > logSize);
+
+        // The pages of new objects are only known from the log.
+        [self doTestRetrieveWithCorruptedHeader:self.objects];
+    }];
+    [self.database enableAutoCheckpoint:YES];
+}
+
+- (void)test_torn_tail
+{
+    [self executeTest:^{
+        [self doFullBackup];
+        [self doBackupWithMaterialLog];
+        NSArray* objectsBeforeTorn = [NSArray arrayWithArray:self.objects];
+        [self doBackupWithMaterialLog];
+
+        // Simulate an interrupted appending
+        auto logSize = [self.fileManager attributesOfItemAtPath:self.database.materialLogPath error:nil].fileSize;
+        NSFileHandle* fileHandle = [NSFileHandle fileHandleForWritingAtPath:self.database.materialLogPath];
+        [fileHandle truncateFileAtOffset:logSize - 1];
+        [fileHandle closeFile];
+
+        [self doTestRetrieveWithCorruptedHeader:objectsBeforeTorn];
+    }];
+    [self.database enableAutoCheckpoint:YES];
+}
+
+- (void)test_compact_torn_log
+{
+    [self executeTest:^{
+        [self doFullBackup];
+        [self doBackupWithMaterialLog];
+        [self doBackupWithMaterialLog];
+
+        auto logSize = [self.fileManager attributesOfItemAtPath:self.database.materialLogPath error:nil].fileSize;
+        NSFileHandle* fileHandle = [NSFileHandle fileHandleForWritingAtPath:self.database.materialLogPath];
+        [fileHandle truncateFileAtOffset:logSize - 1];
+        [fileHandle closeFile];
+
+        // Broken log is not the base of incremental backup, so a full material is saved.
+        [self doTestCompactedAfterBackup];
+        [self doTestRetrieveWithCorruptedHeader:self.objects];
+    }];
+    [self.database enableAutoCheckpoint:YES];
+}
+
+- (void)test_checksum_mismatch
+{
+    __block BOOL corrupted = NO;
+    __block BOOL checksumMismatched = NO;
+    [WCTDatabase globalTraceError:nil];
+    [WCTDatabase globalTraceError:^(WCTError* error) {
+        if (error.code == WCTErrorCodeCorrupt && [error.message isEqualToString:@"Material log is corrupted"]) {
+            corrupted = YES;
+            if ([error.userInfo[@"Element"] isEqualToString:@"Checksum"]) {
+                checksumMismatched = YES;
+            }
+        }
+    }];
+    [self executeTest:^{
+        corrupted = NO;
+        checksumMismatched = NO;
+        [self doFullBackup];
+        [self doBackupWithMaterialLog];
+        NSArray* objectsBeforeMismatch = [NSArray arrayWithArray:self.objects];
+        [self doBackupWithMaterialLog];
+
+        // The last byte belongs to the entries of last block.
+        NSMutableData* data = [NSMutableData dataWithContentsOfFile:self.database.materialLogPath];
+        unsigned char* bytes = (unsigned char*) data.mutableBytes;
+        bytes[data.length - 1] = ~bytes[data.length - 1];
+        TestCaseAssertTrue([data writeToFile:self.database.materialLogPath atomically:YES]);
+
+        [self doTestRetrieveWithCorruptedHeader:objectsBeforeMismatch];
+        TestCaseAssertTrue(corrupted);
+        // The block of cipher database fails to be decrypted before checksum is verified.
+        TestCaseAssertTrue(checksumMismatched || self.needCipher);
+    }];
+    [WCTDatabase globalTraceError:nil];
+    [self.database enableAutoCheckpoint:YES];
+}
+
+- (void)test_compact_after_full_backup
+{
+    [self executeTest:^{
+        [self doFullBackup];
+        [self doBackupWithMaterialLog];
+        [self doBackupWithMaterialLog];
+
+        // Backup without incremental material is always full.
+        [WCTDatabase setABTestConfigWithName:@"clicfg_wcdb_incremental_backup" andValue:@"0"];
+        [self doTestCompactedAfterBackup];
+        [WCTDatabase setABTestConfigWithName:@"clicfg_wcdb_incremental_backup" andValue:@"1"];
+
+        [self doTestRetrieveWithCorruptedHeader:self.objects];
+    }];
+    [self.database enableAutoCheckpoint:YES];
+}
+
+- (void)test_cipher
+{
+    [self executeTest:^{
+        [self doFullBackup];
+        [self doBackupWithMaterialLog];
+
+        // Blocks of cipher database are encrypted like the materials.
+        NSData* log = [NSData dataWithContentsOfFile:self.database.materialLogPath];
+        NSData* tableName = [self.tableName dataUsingEncoding:NSUTF8StringEncoding];
+        BOOL plain = [log rangeOfData:tableName options:0 range:NSMakeRange(0, log.length)].location != NSNotFound;
+        TestCaseAssertEqual(plain, !self.needCipher);
+
+        [self doTestRetrieveWithCorruptedHeader:self.objects];
+    }];
+    [self.database enableAutoCheckpoint:YES];
+}
+
+@end
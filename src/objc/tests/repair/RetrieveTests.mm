@@ -23,6 +23,7 @@
  */
 
 #import "BackupTestCase.h"
+#import "Crawlable.hpp"
 #import "Random+RepairTestObject.h"
 #import "SizeBasedFactory.h"
 
@@ -271,6 +272,41 @@
     }];
 }
 
+- (void)test_parallel_and_serial_retrieve_corrupted
+{
+    // Enough pages for the subpages to be prefetched in parallel.
+    self.objectCount = 5000;
+    [self
+    executeTest:^{
+        [self.database close:^{
+            TestCaseAssertTrue([self.database truncateCheckpoint]);
+        }];
+        auto numberOfPages = [self.database getNumberOfPages];
+        TestCaseAssertTrue(numberOfPages.succeed() && numberOfPages.value() > 10);
+        int pages = (int) numberOfPages.value();
+        [self.database corruptPage:pages / 3];
+        [self.database corruptPage:pages / 2];
+        [self.database corruptPage:pages * 2 / 3];
+        NSData* corrupted = [NSData dataWithContentsOfFile:self.path];
+        TestCaseAssertTrue(corrupted != nil);
+
+        WCDB::Repair::Crawlable::allowParallelCrawling(false);
+        double serialScore = [self.database retrieve:nil];
+        NSArray* serialObjects = [self.table getObjects];
+        WCDB::Repair::Crawlable::allowParallelCrawling(true);
+
+        TestCaseAssertTrue([self.database removeFiles]);
+        TestCaseAssertTrue([corrupted writeToFile:self.path atomically:YES]);
+        double parallelScore = [self.database retrieve:nil];
+        NSArray* parallelObjects = [self.table getObjects];
+
+        TestCaseAssertTrue(serialScore > 0);
+        TestCaseAssertEqual(serialScore, parallelScore);
+        TestCaseAssertTrue(serialObjects.count > 0 && serialObjects.count <= self.objects.count);
+        TestCaseAssertTrue([serialObjects isEqualToArray:parallelObjects]);
+    }];
+}
+
 #ifndef WCDB_QUICK_TESTS
 - (void)test_backup_huge_database
 {
@@ -119,7 +119,9 @@
             XCTAssertTrue([self.database backup]);
             XCTAssertTrue([self.fileManager fileExistsAtPath:self.database.incrementalMaterialPath]);
             XCTAssertTrue([self.fileManager fileExistsAtPath:self.database.firstMaterialPath]);
-            XCTAssertTrue([self.fileManager fileExistsAtPath:self.database.lastMaterialPath]);
+            // The changes are either appended to the material log or saved as a new material.
+            XCTAssertTrue([self.fileManager fileExistsAtPath:self.database.lastMaterialPath]
+                          || [self.fileManager fileExistsAtPath:self.database.materialLogPath]);
 
             NSArray* objects = [[Random shared] repairObjectsWithClass:_testClass andCount:self.objectCount startingFromIdentifier:1000];
             if ([self.table insertObjects:objects]) {
@@ -131,7 +133,9 @@
             XCTAssertTrue([self.database backup]);
             XCTAssertTrue([self.fileManager fileExistsAtPath:self.database.incrementalMaterialPath]);
             XCTAssertTrue([self.fileManager fileExistsAtPath:self.database.firstMaterialPath]);
-            XCTAssertTrue([self.fileManager fileExistsAtPath:self.database.lastMaterialPath]);
+            // The changes are either appended to the material log or saved as a new material.
+            XCTAssertTrue([self.fileManager fileExistsAtPath:self.database.lastMaterialPath]
+                          || [self.fileManager fileExistsAtPath:self.database.materialLogPath]);
         }
 
         if (_corruptHeader) {
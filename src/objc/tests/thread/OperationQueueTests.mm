@@ -0,0 +1,305 @@
+//
+// Created by qiuwenchen on 2026/10/16.
+//
+
+/*
+ * Tencent is pleased to support the open source community by making
+ * WCDB available.
+ *
+ * Copyright (C) 2017 THL A29 Limited, a Tencent company.
+ * All rights reserved.
+ *
+ * Licensed under the BSD 3-Clause License (the "License"); you may not use
+ * this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ *       https://opensource.org/licenses/BSD-3-Clause
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#import "OperationQueue.hpp"
+#import "TestCase.h"
+#import <condition_variable>
+#import <map>
+#import <mutex>
+
+namespace WCDB {
+
+// Records the operations instead of running them on databases.
+class OperationQueueTestEvent final : public OperationEvent {
+public:
+    OperationQueueTestEvent()
+    : records([NSMutableArray<NSString*> array])
+    , numberOfRunnings(0)
+    , maxNumberOfRunnings(0)
+    , purging(false)
+    , overlapped(false)
+    , held(false)
+    , duration(0)
+    {
+    }
+
+    NSMutableArray<NSString*>* records;
+    int numberOfRunnings;
+    int maxNumberOfRunnings;
+    bool purging;
+    bool overlapped;
+    std::mutex lock;
+
+    // running operations are held until released
+    void hold()
+    {
+        std::lock_guard<std::mutex> lockGuard(lock);
+        held = true;
+    }
+
+    void release()
+    {
+        {
+            std::lock_guard<std::mutex> lockGuard(lock);
+            held = false;
+        }
+        conditional.notify_all();
+    }
+
+    void setDuration(double seconds)
+    {
+        std::lock_guard<std::mutex> lockGuard(lock);
+        duration = seconds;
+    }
+
+    NSUInteger numberOfRecords()
+    {
+        std::lock_guard<std::mutex> lockGuard(lock);
+        return records.count;
+    }
+
+protected:
+    Optional<bool> migrationShouldBeOperated(const UnsafeStringView& path) override final
+    {
+        run(@"migrate", path);
+        return true;
+    }
+
+    Optional<bool> compressionShouldBeOperated(const UnsafeStringView& path) override final
+    {
+        run(@"compress", path);
+        return true;
+    }
+
+    void backupShouldBeOperated(const UnsafeStringView& path) override final
+    {
+        run(@"backup", path);
+    }
+
+    void checkpointShouldBeOperated(const UnsafeStringView& path) override final
+    {
+        run(@"checkpoint", path);
+    }
+
+    void integrityShouldBeChecked(const UnsafeStringView& path) override final
+    {
+        run(@"integrity", path);
+    }
+
+    void purgeShouldBeOperated() override final
+    {
+        run(@"purge", UnsafeStringView());
+    }
+
+    Optional<bool> mergeFTSIndexShouldBeOperated(const UnsafeStringView& path,
+                                                 TableArray newTables,
+                                                 TableArray modifiedTables) override final
+    {
+        WCDB_UNUSED(newTables);
+        WCDB_UNUSED(modifiedTables);
+        run(@"merge", path);
+        return true;
+    }
+
+private:
+    void run(NSString* type, const UnsafeStringView& path)
+    {
+        std::string key = path.data();
+        bool purge = path.empty();
+        double seconds = 0;
+        {
+            std::unique_lock<std::mutex> lockGuard(lock);
+            if (runnings[key]++ > 0 || purging || (purge && numberOfRunnings > 0)) {
+                overlapped = true;
+            }
+            if (purge) {
+                purging = true;
+            }
+            maxNumberOfRunnings = std::max(maxNumberOfRunnings, ++numberOfRunnings);
+            if (purge) {
+                [records addObject:type];
+            } else {
+                [records addObject:[NSString stringWithFormat:@"%@:%s", type, path.data()]];
+            }
+            conditional.wait(lockGuard, [this]() { return !held; });
+            seconds = duration;
+        }
+        [NSThread sleepForTimeInterval:seconds];
+        {
+            std::lock_guard<std::mutex> lockGuard(lock);
+            --runnings[key];
+            --numberOfRunnings;
+            if (purge) {
+                purging = false;
+            }
+        }
+    }
+
+    std::map<std::string, int> runnings;
+    std::condition_variable conditional;
+    bool held;
+    double duration;
+};
+
+} // namespace WCDB
+
+@interface OperationQueueTests : BaseTestCase
+
+@end
+
+@implementation OperationQueueTests {
+    WCDB::OperationQueueTestEvent* _event;
+    WCDB::OperationQueue* _queue;
+}
+
+- (void)setUp
+{
+    [super setUp];
+    _event = new WCDB::OperationQueueTestEvent();
+    _queue = new WCDB::OperationQueue(self.testName.UTF8String, _event);
+}
+
+- (void)tearDown
+{
+    _event->release();
+    _queue->stop();
+    delete _queue;
+    delete _event;
+    [super tearDown];
+}
+
+- (BOOL)waitUntil:(BOOL (^)(void))condition
+{
+    NSDate* deadline = [NSDate dateWithTimeIntervalSinceNow:10];
+    while (!condition()) {
+        if ([deadline timeIntervalSinceNow] < 0) {
+            return NO;
+        }
+        [NSThread sleepForTimeInterval:0.01];
+    }
+    return YES;
+}
+
+- (BOOL)waitUntilNumberOfExecutedOperations:(uint64_t)numberOfExecutedOperations
+{
+    return [self waitUntil:^BOOL {
+        return _queue->getStatistics().numberOfExecutedOperations == numberOfExecutedOperations;
+    }];
+}
+
+- (BOOL)waitUntilNumberOfWaitingOperations:(size_t)numberOfWaitingOperations
+{
+    return [self waitUntil:^BOOL {
+        auto statistics = _queue->getStatistics();
+        return statistics.numberOfPendingOperations == 0
+               && statistics.numberOfWaitingOperations == numberOfWaitingOperations;
+    }];
+}
+
+- (void)test_serialized_by_database
+{
+    _queue->setNumberOfWorkers(4);
+    _event->setDuration(0.2);
+    _queue->run();
+
+    for (const char* path : { "a", "b" }) {
+        _queue->registerAsRequiredCheckpoint(path);
+        _queue->registerAsRequiredBackup(path);
+    }
+    for (const char* path : { "a", "b" }) {
+        _queue->asyncCheckpoint(path, 0);
+        _queue->asyncBackup(path, true);
+    }
+    TestCaseAssertTrue([self waitUntilNumberOfExecutedOperations:4]);
+
+    // Different databases are operated concurrently, while the same one is not.
+    TestCaseAssertFalse(_event->overlapped);
+    TestCaseAssertEqual(_event->maxNumberOfRunnings, 2);
+
+    auto statistics = _queue->getStatistics();
+    TestCaseAssertEqual(statistics.numberOfWaitingOperations, 0);
+    TestCaseAssertEqual(statistics.numberOfRunningOperations, 0);
+    // The second operation of each database waits for the first one.
+    TestCaseAssertTrue(statistics.maxLatency >= 0.2);
+}
+
+- (void)test_priority
+{
+    _queue->setNumberOfWorkers(1);
+    _queue->run();
+
+    _queue->registerAsRequiredBackup("blocker");
+    _queue->registerAsRequiredCompression("compress");
+    _queue->registerAsRequiredBackup("backup");
+    _queue->registerAsRequiredCheckpoint("checkpoint");
+
+    _event->hold();
+    _queue->asyncBackup("blocker", true);
+    TestCaseAssertTrue([self waitUntil:^BOOL {
+        return _event->numberOfRecords() == 1;
+    }]);
+
+    // Queued in the reverse order of priority.
+    _queue->asyncCompress("compress");
+    _queue->asyncBackup("backup", true);
+    _queue->asyncCheckpoint("checkpoint", 0);
+    TestCaseAssertTrue([self waitUntilNumberOfWaitingOperations:3]);
+    _event->release();
+
+    TestCaseAssertTrue([self waitUntilNumberOfExecutedOperations:4]);
+    NSArray<NSString*>* expected = @[ @"backup:blocker", @"checkpoint:checkpoint", @"backup:backup", @"compress:compress" ];
+    TestCaseAssertObjectEqual(_event->records, expected);
+}
+
+- (void)test_purge_exclusively
+{
+    _queue->setNumberOfWorkers(4);
+    _queue->run();
+
+    for (const char* path : { "a", "b", "c" }) {
+        _queue->registerAsRequiredBackup(path);
+    }
+
+    _event->hold();
+    _queue->asyncBackup("a", true);
+    _queue->asyncBackup("b", true);
+    TestCaseAssertTrue([self waitUntil:^BOOL {
+        return _event->numberOfRecords() == 2;
+    }]);
+
+    // Purge waits for the running operations, and the later ones wait for purge even though there are idle workers.
+    static_cast<WCDB::OperationQueueForMemory*>(_queue)->asyncPurgeWhenMemoryWarning();
+    TestCaseAssertTrue([self waitUntilNumberOfWaitingOperations:1]);
+    _queue->asyncBackup("c", true);
+    TestCaseAssertTrue([self waitUntilNumberOfWaitingOperations:2]);
+    TestCaseAssertEqual(_event->numberOfRecords(), 2);
+    _event->release();
+
+    TestCaseAssertTrue([self waitUntilNumberOfExecutedOperations:4]);
+    TestCaseAssertFalse(_event->overlapped);
+    TestCaseAssertObjectEqual(_event->records[2], @"purge");
+    TestCaseAssertObjectEqual(_event->records[3], @"backup:c");
+}
+
+@end
@@ -87,4 +87,29 @@ WCDB::SyntaxList<WCDB::Expression> acceptable(const WCDB::SyntaxList<WCDB::Expre
     TestCaseAssertSQLEqual(acceptable(values), @"1, 2");
 }
 
+- (void)test_list_compatible_methods
+{
+    WCDB::SyntaxList<WCDB::Expression> expressions = { 1, 2, 3 };
+    expressions.push_front(0);
+    expressions.emplace_front(WCDB::Column("a"));
+    expressions.pop_front();
+    TestCaseAssertSQLEqual(expressions, @"0, 1, 2, 3");
+
+    WCDB::SyntaxList<WCDB::Expression> others = { 9, 8 };
+    expressions.splice(expressions.begin() + 1, others, others.begin());
+    TestCaseAssertSQLEqual(expressions, @"0, 9, 1, 2, 3");
+    expressions.splice(expressions.end(), others);
+    TestCaseAssertSQLEqual(expressions, @"0, 9, 1, 2, 3, 8");
+    TestCaseAssertTrue(others.empty());
+
+    expressions.remove(2);
+    TestCaseAssertSQLEqual(expressions, @"0, 9, 1, 3, 8");
+    expressions.sort([](const WCDB::Expression& left, const WCDB::Expression& right) {
+        return left.getDescription().compare(right.getDescription()) < 0;
+    });
+    TestCaseAssertSQLEqual(expressions, @"0, 1, 3, 8, 9");
+    expressions.reverse();
+    TestCaseAssertSQLEqual(expressions, @"9, 8, 3, 1, 0");
+}
+
 @end